@@ -5,27 +5,34 @@
 #include <memory>
 #include <iomanip>
 #include <sstream>
+#include "Money.h"
+#include "CategoryDictionary.h"
+#include "../utils/DateUtils.h"
 
 class Budget {
 private:
-    std::string category;     // Category name (e.g., "Food", "Entertainment")
-    std::string yearMonth;    // Year and month in YYYY-MM format (e.g., "2023-06")
-    double limitAmount;       // Budget limit amount for the specified category and month
+    CategoryId categoryId;    // Interned category (e.g., "Food", "Entertainment")
+    MonthKey monthKey;        // Month ordinal (see DateUtils::toMonthKey)
+    Money limitAmount;        // Budget limit amount for the specified category and month
 
 public:
     // Constructors
     Budget();
-    Budget(const std::string& category, const std::string& yearMonth, double limitAmount);
+    Budget(const std::string& category, MonthKey monthKey, Money limitAmount);
 
     // Getters and Setters
     std::string getCategory() const;
     void setCategory(const std::string& category);
+    CategoryId getCategoryId() const;
 
+    MonthKey getMonthKey() const;
+    void setMonthKey(MonthKey monthKey);
+
+    // Year-month formatted as YYYY-MM for display
     std::string getYearMonth() const;
-    void setYearMonth(const std::string& yearMonth);
 
-    double getLimitAmount() const;
-    void setLimitAmount(double limitAmount);
+    Money getLimitAmount() const;
+    void setLimitAmount(Money limitAmount);
 
     // Utility methods
     std::string getFormattedAmount() const;
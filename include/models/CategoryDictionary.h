@@ -0,0 +1,78 @@
+#ifndef CATEGORY_DICTIONARY_H
+#define CATEGORY_DICTIONARY_H
+
+#include <string>
+#include <deque>
+#include <unordered_map>
+#include <shared_mutex>
+#include <cstdint>
+
+/**
+ * Compact identifier for an interned category name
+ */
+using CategoryId = std::uint32_t;
+
+/**
+ * Process-wide intern table for category names
+ *
+ * Transactions, budgets and the category manager store a CategoryId
+ * instead of their own copy of the name, so category filters are
+ * integer compares and renaming a category is a single update here.
+ */
+class CategoryDictionary {
+private:
+    // Indexed by CategoryId; names are only read or written under the mutex
+    std::deque<std::string> names;
+    std::unordered_map<std::string, CategoryId> lookup;
+    mutable std::shared_mutex mutex;
+
+    CategoryDictionary() = default;
+
+public:
+    CategoryDictionary(const CategoryDictionary&) = delete;
+    CategoryDictionary& operator=(const CategoryDictionary&) = delete;
+
+    /**
+     * Gets the shared dictionary instance
+     */
+    static CategoryDictionary& instance();
+
+    /**
+     * Returns the id for a category name, adding it if it is new
+     *
+     * @param name The category name
+     * @return The category's id
+     */
+    CategoryId intern(const std::string& name);
+
+    /**
+     * Looks up an existing category without adding it
+     *
+     * @param name The category name
+     * @param id Receives the id when found
+     * @return true if the name is known, false otherwise
+     */
+    bool find(const std::string& name, CategoryId& id) const;
+
+    /**
+     * Gets the current name for an id
+     * Returned by value: a concurrent rename() may replace the stored name
+     *
+     * @param id The category id
+     * @return Copy of the interned name
+     */
+    std::string getName(CategoryId id) const;
+
+    /**
+     * Renames a category in place; every holder of the id sees the new name
+     *
+     * @param id The category id
+     * @param newName The new name (must not already be in use)
+     * @return true if renamed, false if the id is unknown or the name is taken
+     */
+    bool rename(CategoryId id, const std::string& newName);
+
+    size_t size() const;
+};
+
+#endif // CATEGORY_DICTIONARY_H
@@ -0,0 +1,105 @@
+#ifndef MONEY_H
+#define MONEY_H
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Fixed-point monetary amount stored as a 64-bit count of cents
+ *
+ * Integer arithmetic keeps sums exact and independent of summation
+ * order, so totals always reconcile to the cent.
+ */
+class Money {
+private:
+    std::int64_t cents;
+
+    constexpr explicit Money(std::int64_t cents) : cents(cents) {}
+
+public:
+    /**
+     * Default constructor (zero)
+     */
+    constexpr Money() : cents(0) {}
+
+    /**
+     * Creates an amount from a whole number of cents
+     *
+     * @param cents The amount in cents
+     * @return Money holding exactly that many cents
+     */
+    static constexpr Money fromCents(std::int64_t cents) { return Money(cents); }
+
+    /**
+     * Converts a floating-point value to the nearest cent
+     * Intended for user input only; stored data should be parsed with fromString
+     *
+     * @param value The amount in currency units
+     * @param amount Receives the amount on success
+     * @return true if the value is finite and its cents fit in 64 bits
+     */
+    static bool tryFromDouble(double value, Money& amount);
+
+    /**
+     * Parses a decimal amount (e.g. "12", "-3.5", "1234.56")
+     *
+     * @param text The text to parse
+     * @return The parsed amount
+     * @throws std::invalid_argument if the text is not a valid amount
+     */
+    static Money fromString(const std::string& text);
+
+    /**
+     * Parses a decimal amount without throwing or allocating
+     * Same grammar as fromString; plain amounts are read exactly, anything
+     * else (exponents, extra decimals) via a locale-independent from_chars.
+     *
+     * @param text The text to parse
+     * @param amount Receives the amount on success
+     * @return true if the text is a valid amount, false otherwise (including
+     *         amounts too large to hold in 64-bit cents)
+     */
+    static bool parse(std::string_view text, Money& amount);
+
+    constexpr std::int64_t getCents() const { return cents; }
+    double toDouble() const { return static_cast<double>(cents) / 100.0; }
+
+    /**
+     * Formats the amount with exactly two decimals and no currency symbol
+     *
+     * @return Formatted amount (e.g. "1234.50", "-0.75")
+     */
+    std::string toString() const;
+
+    /**
+     * Divides the amount, rounding to the nearest cent with halves away from zero
+     * (so -0.03 / 2 is -0.02, the mirror of 0.03 / 2)
+     *
+     * @param divisor A positive count (e.g. rows or days)
+     * @return The rounded quotient
+     */
+    Money dividedBy(std::int64_t divisor) const;
+
+    // Arithmetic
+    constexpr Money operator+(Money other) const { return Money(cents + other.cents); }
+    constexpr Money operator-(Money other) const { return Money(cents - other.cents); }
+    constexpr Money operator-() const { return Money(-cents); }
+    Money& operator+=(Money other) { cents += other.cents; return *this; }
+    Money& operator-=(Money other) { cents -= other.cents; return *this; }
+
+    // Comparison
+    constexpr bool operator==(Money other) const { return cents == other.cents; }
+    constexpr bool operator!=(Money other) const { return cents != other.cents; }
+    constexpr bool operator<(Money other) const { return cents < other.cents; }
+    constexpr bool operator<=(Money other) const { return cents <= other.cents; }
+    constexpr bool operator>(Money other) const { return cents > other.cents; }
+    constexpr bool operator>=(Money other) const { return cents >= other.cents; }
+};
+
+inline std::ostream& operator<<(std::ostream& os, Money money) {
+    return os << money.toString();
+}
+
+#endif // MONEY_H
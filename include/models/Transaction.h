@@ -2,14 +2,18 @@
 #define TRANSACTION_H
 
 #include <string>
+#include <cstdint>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include "Money.h"
+#include "CategoryDictionary.h"
+#include "../utils/DateUtils.h"
 
 /**
  * Enumeration defining transaction types
  */
-enum class TransactionType {
+enum class TransactionType : std::uint8_t {
     INCOME,
     EXPENSE
 };
@@ -22,18 +26,19 @@ enum class TransactionType {
  */
 class Transaction {
 private:
-    double amount;
+    Money amount;
     time_t date;
-    std::string category;
+    CategoryId categoryId;
     TransactionType type;
 
-    // Cached YYYY-MM string to avoid repeated localtime() calls
-    mutable std::string cachedMonthKey;
+    // Month and day ordinals derived from date, used for grouping and ranges
+    MonthKey monthKey;
+    DayKey dayKey;
 
     /**
-     * Updates the cached month key when date changes
+     * Recomputes the month and day ordinals when date changes
      */
-    void updateMonthKeyCache() const;
+    void updatePeriodKeys();
 
 public:
     /**
@@ -49,16 +54,28 @@ public:
      * @param category The transaction category
      * @param type The transaction type (INCOME or EXPENSE)
      */
-    Transaction(double amount, time_t date, const std::string& category,
+    Transaction(Money amount, time_t date, const std::string& category,
+        TransactionType type);
+
+    /**
+     * Constructor taking an already interned category
+     *
+     * @param amount The transaction amount
+     * @param date The transaction date as time_t
+     * @param categoryId The transaction category id
+     * @param type The transaction type (INCOME or EXPENSE)
+     */
+    Transaction(Money amount, time_t date, CategoryId categoryId,
         TransactionType type);
 
     // Core getters and setters
-    double getAmount() const;
-    void setAmount(double amount);
+    Money getAmount() const;
+    void setAmount(Money amount);
     time_t getDate() const;
     void setDate(time_t date);
     std::string getCategory() const;
     void setCategory(const std::string& category);
+    CategoryId getCategoryId() const;
     TransactionType getType() const;
     void setType(TransactionType type);
 
@@ -92,13 +109,44 @@ public:
      */
     std::string getDisplayString() const;
 
+    // Shared formatting helpers (also used by TransactionRef)
+
+    /**
+     * Formats an amount with currency symbol, negative for expenses
+     *
+     * @param amount The amount
+     * @param type The transaction type
+     * @return "$12.50" for income, "-$12.50" for expenses
+     */
+    static std::string formatAmount(Money amount, TransactionType type);
+
+    /**
+     * Gets a transaction type as a string
+     *
+     * @return "Income" or "Expense"
+     */
+    static std::string typeToString(TransactionType type);
+
+    /**
+     * Builds the display string "[date] Type: Category - Amount"
+     */
+    static std::string formatDisplayString(const std::string& formattedDate, TransactionType type,
+        const std::string& category, Money amount);
+
+    /**
+     * Gets the month ordinal for grouping by month
+     * Format with DateUtils::formatMonthKey for display
+     *
+     * @return Month ordinal (year * 12 + month - 1)
+     */
+    MonthKey getMonthKey() const;
+
     /**
-     * Gets the month key (YYYY-MM) for grouping by month
-     * Uses caching to avoid repeated date calculations
+     * Gets the day ordinal for date ranges
      *
-     * @return Month key in YYYY-MM format
+     * @return Days since 1970-01-01
      */
-    std::string getMonthKey() const;
+    DayKey getDayKey() const;
 };
 
 #endif // TRANSACTION_H
\ No newline at end of file
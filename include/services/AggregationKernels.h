@@ -0,0 +1,92 @@
+#ifndef AGGREGATION_KERNELS_H
+#define AGGREGATION_KERNELS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include "../models/Transaction.h"
+
+/**
+ * Masked aggregates over the store's amount column
+ *
+ * The kernels take raw column pointers for a contiguous run of rows (the
+ * date dimension is handled by choosing the run). They are vectorized
+ * with AVX2 or SSE4.2 when the CPU supports it, chosen once at runtime,
+ * and fall back to a portable scalar loop otherwise. All variants produce
+ * identical results.
+ */
+class AggregationKernels {
+public:
+    /**
+     * Which rows of the run take part in an aggregate
+     */
+    struct Mask {
+        bool filterType = false;
+        TransactionType type = TransactionType::EXPENSE;
+        bool filterCategory = false;
+        CategoryId categoryId = 0;
+        std::int64_t minCents = std::numeric_limits<std::int64_t>::min();
+        std::int64_t maxCents = std::numeric_limits<std::int64_t>::max();
+    };
+
+    /**
+     * Sum, count, min and max of the selected amounts (in cents)
+     * min/max are only meaningful when count > 0
+     */
+    struct Aggregate {
+        std::int64_t sum = 0;
+        size_t count = 0;
+        std::int64_t min = std::numeric_limits<std::int64_t>::max();
+        std::int64_t max = std::numeric_limits<std::int64_t>::min();
+    };
+
+    /**
+     * Income/expense split of a run, as needed by the ledger totals
+     */
+    struct TypeTotals {
+        std::int64_t incomeCents = 0;
+        std::int64_t expenseCents = 0;
+        size_t incomeCount = 0;
+        size_t expenseCount = 0;
+        std::int64_t minCents = std::numeric_limits<std::int64_t>::max();
+        std::int64_t maxCents = std::numeric_limits<std::int64_t>::min();
+    };
+
+    /**
+     * Aggregates the amounts of the rows that pass the mask
+     *
+     * @param amounts Amount column (cents) of the run
+     * @param types Type column of the run
+     * @param categories Category column of the run
+     * @param count Number of rows in the run
+     * @param mask Row selection
+     */
+    static Aggregate aggregate(const std::int64_t* amounts, const TransactionType* types,
+        const CategoryId* categories, size_t count, const Mask& mask);
+
+    /**
+     * Splits a run into income and expense totals in one pass
+     *
+     * @param amounts Amount column (cents) of the run
+     * @param types Type column of the run
+     * @param count Number of rows in the run
+     */
+    static TypeTotals totalsByType(const std::int64_t* amounts, const TransactionType* types, size_t count);
+
+    /**
+     * Gets the instruction set the kernels dispatched to ("avx2", "sse4.2" or "scalar")
+     */
+    static const char* activeInstructionSet();
+
+    /**
+     * Pins the kernels to one instruction set, e.g. to compare the variants
+     * Not meant to be called while other threads are aggregating.
+     *
+     * @param name "avx2", "sse4.2" or "scalar"; empty restores the automatic choice
+     * @return false (and nothing changes) if the name is unknown or the CPU lacks it
+     */
+    static bool forceInstructionSet(const std::string& name);
+};
+
+#endif // AGGREGATION_KERNELS_H
@@ -0,0 +1,71 @@
+#ifndef AMOUNT_INDEX_H
+#define AMOUNT_INDEX_H
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "TransactionStore.h"
+
+/**
+ * Secondary index holding the ledger's rows ordered by amount
+ *
+ * The permutation is kept alongside the store's date order, so an amount
+ * range is located with two binary searches and the largest amounts in a
+ * range are read straight off its upper end.
+ */
+class AmountIndex {
+private:
+    // Row indices sorted by amount (ascending)
+    std::vector<TransactionStore::RowIndex> rowsByAmount;
+
+    // Buffers reused across bulk appends: the sorted new rows and the merge target
+    std::vector<TransactionStore::RowIndex> appendedRows;
+    std::vector<TransactionStore::RowIndex> mergedRows;
+
+public:
+    // Appends of at most this many rows are inserted in place instead of merged
+    static const size_t MAX_INPLACE_APPEND = 8;
+
+    void clear();
+
+    /**
+     * Rebuilds the permutation from the store
+     *
+     * @param store The ledger to index
+     */
+    void rebuild(const TransactionStore& store);
+
+    /**
+     * Indexes rows that were appended after all existing rows
+     * A few rows are inserted one by one with a binary search; larger batches
+     * are sorted and merged in one linear pass into a reused buffer
+     *
+     * @param store The ledger
+     * @param firstRow Index of the first appended row
+     */
+    void onAppend(const TransactionStore& store, size_t firstRow);
+
+    /**
+     * Indexes a row inserted in the middle of the ledger
+     * Rows at or after the insertion point shift up by one
+     *
+     * @param store The ledger (already containing the new row)
+     * @param row Index the row was inserted at
+     */
+    void onInsert(const TransactionStore& store, size_t row);
+
+    /**
+     * Finds the positions in the permutation whose amount lies in a range
+     *
+     * @param store The ledger
+     * @param minCents The minimum amount in cents (inclusive)
+     * @param maxCents The maximum amount in cents (inclusive)
+     * @return Half-open range [first, second) of positions in rows()
+     */
+    std::pair<size_t, size_t> findRange(const TransactionStore& store,
+        std::int64_t minCents, std::int64_t maxCents) const;
+
+    const std::vector<TransactionStore::RowIndex>& rows() const { return rowsByAmount; }
+};
+
+#endif // AMOUNT_INDEX_H
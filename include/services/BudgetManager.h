@@ -5,24 +5,27 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <cstdint>
 #include "../models/Budget.h"
 #include "../models/UserProfile.h"
 
 class BudgetManager {
 private:
     // Use unordered_map for O(1) lookups instead of O(n) vector scans
-    std::unordered_map<std::string, std::shared_ptr<Budget>> budgets;
+    std::unordered_map<std::uint64_t, std::shared_ptr<Budget>> budgets;
     std::string filePath; // Will be set based on the user profile
     std::shared_ptr<UserProfile> userProfile; // Add user profile reference
 
     const std::string dataFilePath = "data/budgets.csv";
 
-    // Helper method to create a unique key for the map
-    std::string createBudgetKey(const std::string& category, const std::string& yearMonth) const {
-        return category + "|" + yearMonth;
+public:
+    // Packs (category id, month ordinal) into one integer; keyed by id so
+    // renaming a category keeps its budgets. Also keys the ledger's
+    // per-category monthly spend.
+    static std::uint64_t createBudgetKey(CategoryId categoryId, MonthKey monthKey) {
+        return (static_cast<std::uint64_t>(categoryId) << 32) | static_cast<std::uint32_t>(monthKey);
     }
 
-public:
     BudgetManager();
     BudgetManager(std::shared_ptr<UserProfile> profile);
 
@@ -30,17 +33,19 @@ public:
 
     // Core budget operations
     void addBudget(const std::shared_ptr<Budget>& budget);
-    void updateBudget(const std::string& category, const std::string& yearMonth, double newLimit);
-    bool removeBudget(const std::string& category, const std::string& yearMonth);
+    void updateBudget(const std::string& category, MonthKey monthKey, Money newLimit);
+    bool removeBudget(const std::string& category, MonthKey monthKey);
 
     // Retrieval methods
     std::vector<std::shared_ptr<Budget>> getAllBudgets() const;
     std::vector<std::shared_ptr<Budget>> getBudgetsByCategory(const std::string& category) const;
-    std::vector<std::shared_ptr<Budget>> getBudgetsByYearMonth(const std::string& yearMonth) const;
-    std::shared_ptr<Budget> getBudget(const std::string& category, const std::string& yearMonth) const;
+    std::vector<std::shared_ptr<Budget>> getBudgetsByCategory(CategoryId categoryId) const;
+    std::vector<std::shared_ptr<Budget>> getBudgetsByYearMonth(MonthKey monthKey) const;
+    std::shared_ptr<Budget> getBudget(const std::string& category, MonthKey monthKey) const;
+    std::shared_ptr<Budget> getBudget(CategoryId categoryId, MonthKey monthKey) const;
 
     // Check if a budget exists
-    bool hasBudget(const std::string& category, const std::string& yearMonth) const;
+    bool hasBudget(const std::string& category, MonthKey monthKey) const;
 
     // Data persistence
     void saveBudgets();
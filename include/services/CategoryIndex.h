@@ -0,0 +1,54 @@
+#ifndef CATEGORY_INDEX_H
+#define CATEGORY_INDEX_H
+
+#include <vector>
+#include <unordered_map>
+#include "TransactionStore.h"
+
+/**
+ * Secondary index from category id to the rows of that category
+ *
+ * Each posting list holds row indices in ascending (date) order, so a
+ * category lookup costs time proportional to its result size.
+ */
+class CategoryIndex {
+private:
+    std::unordered_map<CategoryId, std::vector<TransactionStore::RowIndex>> postings;
+
+public:
+    void clear();
+
+    /**
+     * Rebuilds every posting list from the store
+     *
+     * @param store The ledger to index
+     */
+    void rebuild(const TransactionStore& store);
+
+    /**
+     * Indexes rows that were appended after all existing rows
+     *
+     * @param store The ledger
+     * @param firstRow Index of the first appended row
+     */
+    void onAppend(const TransactionStore& store, size_t firstRow);
+
+    /**
+     * Indexes a row inserted in the middle of the ledger
+     * Rows at or after the insertion point shift up by one
+     *
+     * @param store The ledger (already containing the new row)
+     * @param row Index the row was inserted at
+     */
+    void onInsert(const TransactionStore& store, size_t row);
+
+    /**
+     * Gets the rows of a category in date order
+     *
+     * @param categoryId The category id
+     * @return Posting list, or nullptr if the category has no rows
+     */
+    const std::vector<TransactionStore::RowIndex>* find(CategoryId categoryId) const;
+};
+
+#endif // CATEGORY_INDEX_H
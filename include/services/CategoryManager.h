@@ -6,18 +6,22 @@
 #include <map>
 #include <set>
 #include "../models/Transaction.h"
+#include "../models/CategoryDictionary.h"
 
 class CategoryManager {
 private:
-    // Default categories for income and expense
-    std::map<TransactionType, std::set<std::string>> defaultCategories;
+    // Default categories for income and expense (ids in the shared CategoryDictionary)
+    std::map<TransactionType, std::set<CategoryId>> defaultCategories;
 
     // Custom categories added by user
-    std::map<TransactionType, std::set<std::string>> customCategories;
+    std::map<TransactionType, std::set<CategoryId>> customCategories;
 
     // Initialize default categories
     void initializeDefaultCategories();
 
+    // Resolves ids to their current names, sorted alphabetically
+    std::vector<std::string> toSortedNames(const std::set<CategoryId>& ids) const;
+
 public:
     // Constructor
     CategoryManager();
@@ -37,6 +41,9 @@ public:
     // Remove a custom category (default categories cannot be removed)
     bool removeCategory(const std::string& category, TransactionType type);
 
+    // Rename a custom category; transactions and budgets using it see the new name
+    bool renameCategory(const std::string& category, const std::string& newName, TransactionType type);
+
     // Check if a category exists
     bool categoryExists(const std::string& category, TransactionType type) const;
 
@@ -0,0 +1,80 @@
+#ifndef DAILY_TOTALS_INDEX_H
+#define DAILY_TOTALS_INDEX_H
+
+#include <vector>
+#include <cstdint>
+#include "TransactionStore.h"
+
+/**
+ * Per-day income and expense totals held in Fenwick (binary indexed) trees
+ *
+ * The trees are keyed by the distinct days that hold transactions, not by
+ * every calendar day between the oldest and newest row, so one stray date
+ * (a mistyped year) costs one slot rather than centuries of empty ones.
+ * Any inclusive day range is summed in O(log days) after two binary
+ * searches. Adding to an existing day or a day after the newest one is
+ * O(log days); a new day earlier than the newest shifts the slots and
+ * rebuilds the trees in O(days).
+ */
+class DailyTotalsIndex {
+private:
+    // Distinct days with transactions, ascending; slot i holds days[i]
+    std::vector<DayKey> days;
+
+    // Raw per-slot totals in cents, kept to rebuild the trees when a day is inserted
+    std::vector<std::int64_t> dailyIncome;
+    std::vector<std::int64_t> dailyExpenses;
+
+    // 1-based Fenwick trees over the slots above
+    std::vector<std::int64_t> incomeTree;
+    std::vector<std::int64_t> expenseTree;
+
+    // Gets the slot for a day, adding an empty one if needed
+    size_t slotFor(DayKey day);
+    void rebuildTrees();
+
+    // Sum of slots [0, slotCount) of one tree
+    static std::int64_t prefixSum(const std::vector<std::int64_t>& tree, size_t slotCount);
+
+public:
+    void clear();
+
+    /**
+     * Rebuilds the totals from every row of the store in linear time
+     *
+     * @param store The ledger to index
+     */
+    void rebuild(const TransactionStore& store);
+
+    /**
+     * Adds rows [firstRow, store.size()) to the totals
+     *
+     * @param store The ledger
+     * @param firstRow Index of the first new row
+     */
+    void onAppend(const TransactionStore& store, size_t firstRow);
+
+    /**
+     * Adds one amount to a day's total
+     *
+     * @param day The day ordinal
+     * @param type Which total the amount belongs to
+     * @param cents The amount in cents
+     */
+    void add(DayKey day, TransactionType type, std::int64_t cents);
+
+    /**
+     * Sums one type over an inclusive day range
+     *
+     * @param firstDay The first day of the range
+     * @param lastDay The last day of the range
+     * @param type Income or expense
+     * @return Total in cents (0 for an empty or inverted range)
+     */
+    std::int64_t sumRange(DayKey firstDay, DayKey lastDay, TransactionType type) const;
+
+    // Number of distinct days held (memory footprint)
+    size_t dayCount() const { return days.size(); }
+};
+
+#endif // DAILY_TOTALS_INDEX_H
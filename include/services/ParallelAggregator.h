@@ -0,0 +1,110 @@
+#ifndef PARALLEL_AGGREGATOR_H
+#define PARALLEL_AGGREGATOR_H
+
+#include <vector>
+#include <thread>
+#include <exception>
+#include <cstddef>
+
+/**
+ * Chunked parallel reduction over a range of ledger rows
+ *
+ * The range is split into equal contiguous chunks, each chunk is reduced
+ * to a partial result on its own thread, and the partials are merged in
+ * chunk order on the calling thread. Chunking depends only on the range
+ * and the thread count, so results are deterministic for a given setting.
+ * Small ranges are reduced inline without starting threads.
+ */
+class ParallelAggregator {
+private:
+    size_t threadCount;
+
+public:
+    // Below this many rows per chunk, thread start-up costs more than it saves
+    static const size_t MIN_ROWS_PER_CHUNK = 1 << 16;
+
+    /**
+     * @param threadCount Worker count; 0 uses the hardware concurrency
+     */
+    explicit ParallelAggregator(size_t threadCount = 0);
+
+    /**
+     * Sets the worker count; 0 uses the hardware concurrency
+     */
+    void setThreadCount(size_t count);
+    size_t getThreadCount() const { return threadCount; }
+
+    /**
+     * Reduces rows [firstRow, endRow)
+     *
+     * @param map Called as map(chunkFirst, chunkEnd) on a worker; returns a Partial
+     * @param merge Called as merge(Partial& into, Partial&& next) in chunk order
+     * @return The merged result (map(firstRow, endRow) when run inline)
+     */
+    template <typename Partial, typename MapFn, typename MergeFn>
+    Partial reduce(size_t firstRow, size_t endRow, MapFn map, MergeFn merge) const {
+        return reduce<Partial>(firstRow, endRow, MIN_ROWS_PER_CHUNK, map, merge);
+    }
+
+    /**
+     * Reduces [firstRow, endRow) with a caller-chosen minimum chunk size,
+     * for ranges that are not ledger rows or need a different threshold
+     *
+     * @param minPerChunk Smallest range worth a thread, in the range's own units
+     * @param map Called as map(chunkFirst, chunkEnd) on a worker; returns a Partial
+     * @param merge Called as merge(Partial& into, Partial&& next) in chunk order
+     * @return The merged result (map(firstRow, endRow) when run inline)
+     */
+    template <typename Partial, typename MapFn, typename MergeFn>
+    Partial reduce(size_t firstRow, size_t endRow, size_t minPerChunk, MapFn map, MergeFn merge) const {
+        const size_t rowCount = endRow - firstRow;
+        size_t chunks = rowCount / (minPerChunk > 0 ? minPerChunk : 1);
+        if (chunks > threadCount) {
+            chunks = threadCount;
+        }
+        if (chunks <= 1) {
+            return map(firstRow, endRow);
+        }
+
+        std::vector<Partial> partials(chunks);
+        std::vector<std::exception_ptr> errors(chunks);
+        std::vector<std::thread> workers;
+        workers.reserve(chunks - 1);
+
+        auto runChunk = [&](size_t chunk) {
+            size_t chunkFirst = firstRow + rowCount * chunk / chunks;
+            size_t chunkEnd = firstRow + rowCount * (chunk + 1) / chunks;
+            try {
+                partials[chunk] = map(chunkFirst, chunkEnd);
+            }
+            catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+        };
+
+        // The calling thread takes the last chunk
+        for (size_t chunk = 0; chunk + 1 < chunks; ++chunk) {
+            workers.emplace_back(runChunk, chunk);
+        }
+        runChunk(chunks - 1);
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        Partial result = std::move(partials[0]);
+        for (size_t chunk = 1; chunk < chunks; ++chunk) {
+            merge(result, std::move(partials[chunk]));
+        }
+
+        return result;
+    }
+};
+
+#endif // PARALLEL_AGGREGATOR_H
@@ -0,0 +1,70 @@
+#ifndef QUANTILE_SKETCH_H
+#define QUANTILE_SKETCH_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Mergeable quantile sketch over amounts in cents (KLL-style)
+ *
+ * Values live in levels of compactors; an item at level h stands for 2^h
+ * inputs. When a level outgrows its capacity it is sorted and every other
+ * item moves up a level, so memory stays O(k) however many values are
+ * added. Rank error stays within about 2.5/k of the count (under 1% at
+ * the default k, with a few hundred values retained).
+ * Groups smaller than k are kept exactly. Two sketches merge level by
+ * level into a sketch of the combined stream, so partitions can be
+ * sketched independently (per chunk, per month) and combined later.
+ *
+ * Compaction alternates between keeping odd and even positions instead of
+ * flipping a coin, so results are reproducible.
+ */
+class QuantileSketch {
+private:
+    size_t k;
+    size_t count;
+    std::int64_t minValue;
+    std::int64_t maxValue;
+
+    std::vector<std::vector<std::int64_t>> levels;
+
+    // Alternates per level to keep compaction unbiased
+    std::vector<bool> keepOdd;
+
+    size_t capacity(size_t level) const;
+    void compress();
+
+public:
+    static const size_t DEFAULT_K = 400;
+
+    explicit QuantileSketch(size_t k = DEFAULT_K);
+
+    /**
+     * Adds one value to the sketch
+     */
+    void add(std::int64_t value);
+
+    /**
+     * Folds another sketch in; the result summarizes both streams
+     */
+    void merge(const QuantileSketch& other);
+
+    size_t getCount() const { return count; }
+    bool empty() const { return count == 0; }
+    std::int64_t getMin() const { return minValue; }
+    std::int64_t getMax() const { return maxValue; }
+
+    /**
+     * Estimates the value at a rank fraction
+     *
+     * @param fraction Rank in [0, 1] (0.5 = median, 0.9 = p90)
+     * @return Estimated value (0 if the sketch is empty)
+     */
+    std::int64_t quantile(double fraction) const;
+
+    // Number of values currently retained (memory footprint)
+    size_t retained() const;
+};
+
+#endif // QUANTILE_SKETCH_H
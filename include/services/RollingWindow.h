@@ -0,0 +1,103 @@
+#ifndef ROLLING_WINDOW_H
+#define ROLLING_WINDOW_H
+
+#include <vector>
+#include <cstdint>
+#include "TransactionStore.h"
+#include "CategoryIndex.h"
+
+/**
+ * Trailing-window expense total for one day
+ */
+struct RollingPoint {
+    DayKey day = 0;
+    Money dayTotal;             // Expenses on this day alone
+    Money windowSum;            // Expenses in the window ending on this day (inclusive)
+    Money dailyAverage;         // windowSum / window length, rounded to the cent
+};
+
+/**
+ * Series of trailing N-day expense sums, for all categories or one
+ *
+ * The series is produced by a two-pointer sweep over the date-sorted rows
+ * (or the category's posting list): the head pointer adds each day's rows,
+ * the tail pointer drops rows that fell out of the window, so every row is
+ * touched twice whatever the window length.
+ *
+ * Only days where the window changes are stored: days with rows, and days
+ * where rows slide out. On the quiet days in between the window sum is
+ * that of the point before and the day total is zero; pointAt() fills
+ * them in. The series therefore grows with the number of distinct days,
+ * not the calendar span, so a stray date years away costs a couple of
+ * points. It covers the first source row to the newest row of the ledger.
+ *
+ * Appending rows resumes the sweep where it stopped (re-emitting the last
+ * day if new rows share it). Anything that moves existing rows requires
+ * reset() and a fresh update().
+ */
+class RollingWindow {
+private:
+    size_t windowDays;
+    bool filterCategory;
+    CategoryId categoryId;
+
+    // Sweep state; positions index the source sequence (rows or postings)
+    size_t head = 0;
+    size_t tail = 0;
+    std::int64_t windowCents = 0;
+    bool started = false;
+    DayKey nextDay = 0;
+
+    // Change points in day order
+    std::vector<RollingPoint> series;
+
+public:
+    /**
+     * @param windowDays Window length in days (at least 1)
+     */
+    explicit RollingWindow(size_t windowDays);
+
+    /**
+     * @param windowDays Window length in days (at least 1)
+     * @param categoryId Only count expenses in this category
+     */
+    RollingWindow(size_t windowDays, CategoryId categoryId);
+
+    size_t getWindowDays() const { return windowDays; }
+
+    /**
+     * Drops the series and sweep state
+     */
+    void reset();
+
+    /**
+     * Extends the series over rows added since the last update
+     *
+     * @param store The ledger
+     * @param categoryIndex Posting lists, used when filtering by category
+     */
+    void update(const TransactionStore& store, const CategoryIndex& categoryIndex);
+
+    /**
+     * Gets the days where the window changed, oldest first
+     * Use pointAt() for a value on any calendar day.
+     */
+    const std::vector<RollingPoint>& points() const { return series; }
+
+    bool empty() const { return series.empty(); }
+
+    // First day of the series (the oldest source row); only valid when not empty
+    DayKey firstDay() const { return series.front().day; }
+
+    // Last day the sweep has covered (the newest ledger row); only valid when not empty
+    DayKey lastDay() const { return nextDay - 1; }
+
+    /**
+     * Gets the window ending on a day
+     * Days after the series are extrapolated (nothing spent since the newest
+     * row); days before it are empty.
+     */
+    RollingPoint pointAt(DayKey day) const;
+};
+
+#endif // ROLLING_WINDOW_H
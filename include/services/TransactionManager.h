@@ -5,48 +5,168 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <cstdint>
 #include <tuple>
+#include <mutex>
 #include <ctime>
 #include "../models/Transaction.h"
 #include "../services/BudgetManager.h"
+#include "../services/TransactionStore.h"
+#include "../services/CategoryIndex.h"
+#include "../services/AmountIndex.h"
+#include "../services/DailyTotalsIndex.h"
+#include "../services/QuantileSketch.h"
+#include "../services/RollingWindow.h"
+#include "../services/TransactionView.h"
+#include "../services/TransactionQuery.h"
+#include "../services/ParallelAggregator.h"
 #include "../models/UserProfile.h" // Add this include
 
+/**
+ * Running income and expense totals for one month
+ */
+struct MonthlyTotals {
+    Money income;
+    Money expenses;
+
+    Money getNetAmount() const { return income - expenses; }
+};
+
+/**
+ * Snapshot of ledger-wide figures for the financial summary screen
+ */
+struct FinancialSummary {
+    Money totalIncome;
+    Money totalExpenses;
+    Money netAmount;
+    size_t transactionCount = 0;
+    size_t incomeCount = 0;
+    size_t expenseCount = 0;
+    Money minAmount;    // Smallest single transaction amount
+    Money maxAmount;    // Largest single transaction amount
+    Money meanAmount;   // Average transaction amount, rounded to the cent
+};
 
 class TransactionManager {
 private:
-    std::vector<std::shared_ptr<Transaction>> transactions;
+    // Columnar ledger, kept sorted by date (oldest first)
+    TransactionStore store;
+
+    // Secondary indexes over the store
+    CategoryIndex categoryIndex;
+    AmountIndex amountIndex;
+    DailyTotalsIndex dailyTotals;
+
+    // Per-month aggregates, kept up to date as rows are added or loaded
+    std::map<MonthKey, MonthlyTotals> monthlyTotals;
+
+    // Expense total per (category, month), keyed by BudgetManager::createBudgetKey
+    std::unordered_map<std::uint64_t, Money> categoryMonthSpend;
+
+    // Expense amount distribution per (category, month), same keys as above
+    std::unordered_map<std::uint64_t, QuantileSketch> expenseSketches;
+
+    // Ledger-wide running totals (net and mean are derived on read)
+    FinancialSummary runningSummary;
+
+    // Trailing-window expense series keyed by (window days, per category, category id)
+    // Created on first request and extended on read; reset when rows move.
+    // Const readers create and sweep entries, so rollingWindowsMutex guards them.
+    mutable std::map<std::tuple<size_t, bool, CategoryId>, RollingWindow> rollingWindows;
+    mutable std::mutex rollingWindowsMutex;
+
+    // Splits large rebuilds and slice aggregates across threads
+    ParallelAggregator aggregator;
     const std::string dataFilePath = "data/transactions.csv";
     std::string filePath; // Will be set based on the user profile
     std::shared_ptr<UserProfile> userProfile; // Add user profile reference
 
+    // Index and aggregate maintenance after the store changes
+    void onRowInserted(size_t row);
+    void onRowsAppended(size_t firstRow);
+    void rebuildDerivedState();
+    void accumulateRows(size_t firstRow, size_t endRow);
+
+    // Gets a cached window swept up to the newest row; call with rollingWindowsMutex held
+    RollingWindow& sweptWindow(size_t windowDays, bool filterCategory, CategoryId categoryId) const;
+
 public:
     TransactionManager();
     ~TransactionManager();
 
     // Core transaction operations
     void addTransaction(const std::shared_ptr<Transaction>& transaction);
+    void addTransactions(const std::vector<std::shared_ptr<Transaction>>& batch);
     std::vector<std::shared_ptr<Transaction>> getAllTransactions() const;
 
-    // Filtering methods
+    // Zero-copy views (newest first); valid until the manager is next modified
+    TransactionView viewAll() const;
+    TransactionView viewByCategory(const std::string& category) const;
+    TransactionView viewByCategory(CategoryId categoryId) const;
+    TransactionView viewByType(TransactionType type) const;
+    TransactionView viewByDateRange(time_t startDate, time_t endDate) const;
+    TransactionView viewByAmountRange(Money minAmount, Money maxAmount) const;
+    TransactionView viewByMonth(MonthKey month) const;
+
+    // Starts a composable query over the ledger (same lifetime rule as views)
+    TransactionQuery query() const;
+
+    // Filtering methods (materialized copies of the views above)
     std::vector<std::shared_ptr<Transaction>> getTransactionsByCategory(const std::string& category) const;
     std::vector<std::shared_ptr<Transaction>> getTransactionsByType(TransactionType type) const;
     std::vector<std::shared_ptr<Transaction>> getTransactionsByDateRange(time_t startDate, time_t endDate) const;
-    std::vector<std::shared_ptr<Transaction>> getTransactionsByAmountRange(double minAmount, double maxAmount) const;
+    std::vector<std::shared_ptr<Transaction>> getTransactionsByAmountRange(Money minAmount, Money maxAmount) const;
+
+    // The k largest transactions matching a query, largest first
+    // e.g. topK(10, query().ofType(TransactionType::EXPENSE).inMonth(month))
+    TransactionView topK(size_t k, const TransactionQuery& filter) const;
+
+    // Largest transactions (by amount, descending) whose amount lies in the range
+    std::vector<std::shared_ptr<Transaction>> getLargestTransactions(size_t count, Money minAmount, Money maxAmount) const;
 
     bool checkBudgetExceeded(const std::shared_ptr<Transaction>& transaction, const std::shared_ptr<BudgetManager>& budgetManager, std::string& warningMessage) const;
 
+    // Flags an expense that lifts its category's trailing 7-day spend above
+    // twice the weekly rate of the preceding 90 days
+    bool checkSpendingSpike(const std::shared_ptr<Transaction>& transaction, std::string& warningMessage) const;
+
     // Grouping and analysis
-    std::map<std::string, std::vector<std::shared_ptr<Transaction>>> getTransactionsByMonth() const;
-    std::map<std::string, std::tuple<double, double, double>> calculateMonthlySummary() const;
+    std::map<MonthKey, std::vector<std::shared_ptr<Transaction>>> getTransactionsByMonth() const;
+    std::map<MonthKey, std::tuple<Money, Money, Money>> calculateMonthlySummary() const;
+    const std::map<MonthKey, MonthlyTotals>& getMonthlyTotals() const;
 
     // Data persistence
     void saveTransactions();
     void loadTransactions();
 
     // Financial calculations
-    double getTotalIncome() const;
-    double getTotalExpenses() const;
-    double getNetAmount() const;
+    Money getTotalIncome() const;
+    Money getTotalExpenses() const;
+    Money getNetAmount() const;
+    FinancialSummary getFinancialSummary() const;
+
+    // Income or expense total over a date range, whole days inclusive (O(log days))
+    Money sumRange(time_t startDate, time_t endDate, TransactionType type) const;
+
+    // Expenses recorded for a category in a month (O(1))
+    Money getCategoryMonthSpend(CategoryId categoryId, MonthKey monthKey) const;
+
+    // Expense size distributions (median/p90/p99 via QuantileSketch::quantile)
+    QuantileSketch getExpenseSketch(CategoryId categoryId, MonthKey monthKey) const;
+    std::map<CategoryId, QuantileSketch> getCategoryExpenseSketches() const;                 // All months
+    std::map<CategoryId, QuantileSketch> getCategoryExpenseSketches(MonthKey monthKey) const; // One month
+    std::map<MonthKey, QuantileSketch> getMonthlyExpenseSketches() const;                     // All categories
+
+    // Daily series of trailing-window expense sums (e.g. 7/30/90 days)
+    // Returned by value: safe to call from several readers at once, and the
+    // copy stays valid after the manager is modified
+    RollingWindow getRollingSpend(size_t windowDays) const;                       // All categories
+    RollingWindow getRollingSpend(size_t windowDays, CategoryId categoryId) const; // One category
+
+    // Worker threads used for large aggregations (0 = hardware concurrency)
+    void setAggregationThreads(size_t threadCount);
+    size_t getAggregationThreads() const;
 
 
     // Updated constructor to accept a user profile
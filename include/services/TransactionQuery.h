@@ -0,0 +1,165 @@
+#ifndef TRANSACTION_QUERY_H
+#define TRANSACTION_QUERY_H
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <map>
+#include <limits>
+#include <cstdint>
+#include <ctime>
+#include "TransactionStore.h"
+#include "TransactionView.h"
+#include "CategoryIndex.h"
+#include "AmountIndex.h"
+#include "ParallelAggregator.h"
+
+/**
+ * Ways a query can enumerate its candidate rows
+ */
+enum class AccessPath {
+    EMPTY,                  // Some predicate can never match
+    DATE_SLICE,             // Contiguous block of date-sorted rows
+    CATEGORY_POSTINGS,      // Category posting list, clipped to the date slice
+    AMOUNT_RANGE,           // Amount index range, marked in a bitmap over the date slice
+    CATEGORY_AMOUNT         // Category postings tested against that bitmap
+};
+
+/**
+ * Access path chosen for a query, with the statistics it was chosen from
+ */
+struct QueryPlan {
+    AccessPath path = AccessPath::EMPTY;
+
+    // Half-open date slice [firstRow, lastRow)
+    size_t firstRow = 0;
+    size_t lastRow = 0;
+
+    // Candidate counts of each access path (exact, from the indexes)
+    size_t dateRows = 0;
+    size_t categoryRows = 0;
+    size_t amountRows = 0;
+
+    // Expected number of rows left after all predicates
+    size_t estimatedRows = 0;
+    double estimatedCost = 0.0;
+};
+
+/**
+ * Composable filter over the ledger, evaluated lazily in one pass
+ *
+ * Predicates are collected by the builder methods and only evaluated by a
+ * terminal (view, execute, count, sum, sumByMonth, sumByCategory). Every
+ * terminal visits each candidate row once, tests all predicates together,
+ * and stops as soon as the offset/limit window is filled. Results are
+ * ordered newest first, like the TransactionManager filters.
+ *
+ * Candidate rows come from the cheapest access path for the predicates:
+ * the date slice, the category posting list, the amount index, or the
+ * intersection of the last two. explain() describes the choice.
+ *
+ * Example: manager.query().ofType(TransactionType::EXPENSE).inCategory("Food")
+ *              .inMonth(march).amountBetween(Money::fromCents(5000), max).sum()
+ *
+ * A query reads its manager's storage directly and follows the same
+ * lifetime rule as TransactionView.
+ */
+class TransactionQuery {
+private:
+    const TransactionStore* store;
+    const CategoryIndex* categoryIndex;
+    const AmountIndex* amountIndex;
+    const ParallelAggregator* aggregator;
+
+    bool filterType;
+    TransactionType type;
+
+    bool filterCategory;
+    CategoryId categoryId;
+
+    // Set when a predicate can never match (e.g. an unknown category name)
+    bool matchesNothing;
+
+    // Inclusive bounds; the defaults accept every row
+    DayKey firstDay;
+    DayKey lastDay;
+    std::int64_t minCents;
+    std::int64_t maxCents;
+
+    size_t skipCount;
+    size_t maxCount;
+
+    // Part of the category posting list that lies in the date slice
+    std::pair<const TransactionStore::RowIndex*, const TransactionStore::RowIndex*>
+        categoryRange(size_t firstRow, size_t lastRow) const;
+
+    // Bitmap over the date slice marking rows whose amount is in range
+    std::vector<std::uint64_t> amountBitmap(size_t firstRow, size_t lastRow) const;
+
+    bool matches(size_t row) const;
+
+    /**
+     * Runs the fused scan over the planned access path, newest row first
+     * Calls visit(row) for each matching row inside the offset/limit window
+     */
+    template <typename Visitor>
+    void scan(const QueryPlan& chosen, Visitor&& visit) const;
+
+    // Sums/counts an unwindowed date-slice plan with the vector kernels, split across
+    // the aggregator's threads; false if not applicable
+    bool aggregateSlice(const QueryPlan& chosen, std::int64_t& sum, size_t& count) const;
+
+public:
+    TransactionQuery(const TransactionStore& store, const CategoryIndex& categoryIndex, const AmountIndex& amountIndex,
+        const ParallelAggregator& aggregator);
+
+    // Predicates; each call narrows the query further
+    TransactionQuery& ofType(TransactionType type);
+    TransactionQuery& inCategory(const std::string& category);
+    TransactionQuery& inCategory(CategoryId categoryId);
+    TransactionQuery& betweenDates(time_t startDate, time_t endDate);    // Whole days, inclusive
+    TransactionQuery& inMonth(MonthKey month);
+    TransactionQuery& amountBetween(Money minAmount, Money maxAmount);   // Inclusive
+
+    // Result window over the matching rows (newest first)
+    TransactionQuery& offset(size_t count);
+    TransactionQuery& limit(size_t count);
+
+    /**
+     * Gets the matching rows without copying them
+     */
+    TransactionView view() const;
+
+    /**
+     * Gets the matching rows as Transaction objects
+     */
+    std::vector<std::shared_ptr<Transaction>> execute() const;
+
+    /**
+     * Gets the k largest matching rows by amount (largest first; ties go to
+     * the newer row). Uses a bounded heap over the planned candidates, or
+     * walks the amount index downwards and stops after k hits when that is
+     * cheaper. With offset/limit set, ranks only the rows in the window.
+     */
+    TransactionView topK(size_t k) const;
+
+    /**
+     * Chooses the access path by comparing estimated costs
+     * Candidate counts are exact (binary searches over the indexes); the
+     * final row count assumes the predicates are independent
+     */
+    QueryPlan plan() const;
+
+    /**
+     * Describes the chosen plan and the alternatives it was weighed against
+     */
+    std::string explain() const;
+
+    // Aggregate terminals
+    size_t count() const;
+    Money sum() const;
+    std::map<MonthKey, Money> sumByMonth() const;
+    std::map<CategoryId, Money> sumByCategory() const;
+};
+
+#endif // TRANSACTION_QUERY_H
@@ -0,0 +1,109 @@
+#ifndef TRANSACTION_STORE_H
+#define TRANSACTION_STORE_H
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <ctime>
+#include <utility>
+#include "../models/Transaction.h"
+
+/**
+ * Columnar (structure-of-arrays) storage for the transaction ledger
+ *
+ * Each transaction field lives in its own contiguous column so that
+ * scans which only need amount and type (totals, summaries, filters)
+ * touch just those columns instead of a heap object per row.
+ * Rows are kept sorted by date (oldest first); Transaction objects are
+ * only built on demand through materialize().
+ */
+class TransactionStore {
+public:
+    // Compact row index used by secondary indexes
+    using RowIndex = std::uint32_t;
+
+private:
+    std::vector<time_t> dateColumn;
+    std::vector<std::int64_t> amountColumn; // Amounts in cents
+    std::vector<TransactionType> typeColumn;
+    std::vector<CategoryId> categoryColumn;
+    std::vector<MonthKey> monthKeyColumn;
+    std::vector<DayKey> dayKeyColumn;
+
+    // Appends a row at the end of every column without restoring order
+    void append(const Transaction& transaction);
+
+    /**
+     * Restores date order after rows were appended from firstNew onwards
+     * Sorts only the new rows, then merges them with the existing rows
+     * in one linear pass
+     *
+     * @param firstNew Index of the first appended row
+     * @return true if the appended rows were already in place (no row moved)
+     */
+    bool mergeFrom(size_t firstNew);
+
+public:
+    TransactionStore() = default;
+
+    size_t size() const { return dateColumn.size(); }
+    bool empty() const { return dateColumn.empty(); }
+
+    void clear();
+    void reserve(size_t rowCount);
+
+    /**
+     * Inserts a row at its date position (after rows with the same date)
+     * Appending a transaction that is not older than the newest row is O(1)
+     *
+     * @param transaction The transaction to copy into the columns
+     * @return Row index the transaction was stored at
+     */
+    size_t insert(const Transaction& transaction);
+
+    /**
+     * Inserts a batch of rows, sorting the batch once and merging it linearly
+     *
+     * @param batch The transactions to copy into the columns
+     * @return true if the batch was appended after the existing rows without
+     *         moving any of them, false if rows were reordered
+     */
+    bool insertBatch(const std::vector<std::shared_ptr<Transaction>>& batch);
+
+    /**
+     * Builds a Transaction object for a single row
+     *
+     * @param row Row index in date order
+     * @return Newly allocated transaction holding the row's values
+     */
+    std::shared_ptr<Transaction> materialize(size_t row) const;
+
+    /**
+     * Finds the contiguous rows whose day falls within a range (inclusive)
+     * Uses binary search over the date-sorted day column
+     *
+     * @param firstDay The first day ordinal of the range
+     * @param lastDay The last day ordinal of the range
+     * @return Half-open row range [first, second)
+     */
+    std::pair<size_t, size_t> findDayRange(DayKey firstDay, DayKey lastDay) const;
+
+    /**
+     * Finds the contiguous rows that fall in a calendar month
+     *
+     * @param month The month key
+     * @return Half-open row range [first, second)
+     */
+    std::pair<size_t, size_t> findMonthRange(MonthKey month) const;
+
+    // Column access for scan-based queries
+    const std::vector<time_t>& dates() const { return dateColumn; }
+    const std::vector<std::int64_t>& amountCents() const { return amountColumn; }
+    const std::vector<TransactionType>& types() const { return typeColumn; }
+    const std::vector<CategoryId>& categoryIds() const { return categoryColumn; }
+    const std::vector<MonthKey>& monthKeys() const { return monthKeyColumn; }
+    const std::vector<DayKey>& dayKeys() const { return dayKeyColumn; }
+};
+
+#endif // TRANSACTION_STORE_H
@@ -0,0 +1,140 @@
+#ifndef TRANSACTION_VIEW_H
+#define TRANSACTION_VIEW_H
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <iterator>
+#include <cstddef>
+#include "TransactionStore.h"
+
+/**
+ * Non-owning handle to one row of a TransactionStore
+ *
+ * Offers the same read accessors as Transaction without allocating;
+ * call materialize() when an independent Transaction object is needed.
+ */
+class TransactionRef {
+private:
+    const TransactionStore* store;
+    size_t row;
+
+public:
+    TransactionRef(const TransactionStore& store, size_t row) : store(&store), row(row) {}
+
+    size_t getRow() const { return row; }
+
+    Money getAmount() const { return Money::fromCents(store->amountCents()[row]); }
+    time_t getDate() const { return store->dates()[row]; }
+    CategoryId getCategoryId() const { return store->categoryIds()[row]; }
+    std::string getCategory() const;
+    TransactionType getType() const { return store->types()[row]; }
+    MonthKey getMonthKey() const { return store->monthKeys()[row]; }
+    DayKey getDayKey() const { return store->dayKeys()[row]; }
+
+    // Same formatting as the matching Transaction methods
+    std::string getFormattedDate() const;
+    std::string getFormattedAmount() const;
+    std::string getTypeAsString() const;
+    std::string getDisplayString() const;
+
+    std::shared_ptr<Transaction> materialize() const { return store->materialize(row); }
+};
+
+/**
+ * Lightweight, read-only range of ledger rows, iterated newest first
+ *
+ * A view either covers a contiguous block of rows (all rows, a date range,
+ * a month) or a list of row indices (a category posting list or a filter
+ * result). Views copy no Transaction objects and touch no reference counts.
+ * Ranked results (TransactionQuery::topK) iterate in rank order instead.
+ *
+ * Lifetime: a view points into its TransactionManager's storage and is only
+ * valid until the next call that modifies that manager (adding or loading
+ * transactions, switching profile). Materialize rows that must outlive it.
+ */
+class TransactionView {
+private:
+    const TransactionStore* store;
+
+    // Contiguous block [first, last) when rowList is null
+    size_t first;
+    size_t last;
+
+    // Otherwise rows come from rowList[0, count), read back to front
+    const TransactionStore::RowIndex* rowList;
+    size_t count;
+
+    // Keeps filter results alive for the lifetime of the view
+    std::shared_ptr<const std::vector<TransactionStore::RowIndex>> ownedRows;
+
+public:
+    class iterator {
+    private:
+        const TransactionView* view;
+        size_t index;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TransactionRef;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = TransactionRef;
+
+        iterator() : view(nullptr), index(0) {}
+        iterator(const TransactionView* view, size_t index) : view(view), index(index) {}
+
+        TransactionRef operator*() const { return (*view)[index]; }
+        iterator& operator++() { ++index; return *this; }
+        iterator operator++(int) { iterator previous = *this; ++index; return previous; }
+        bool operator==(const iterator& other) const { return index == other.index; }
+        bool operator!=(const iterator& other) const { return index != other.index; }
+    };
+
+    /**
+     * Empty view
+     */
+    TransactionView();
+
+    /**
+     * View over the contiguous rows [first, last)
+     */
+    TransactionView(const TransactionStore& store, size_t first, size_t last);
+
+    /**
+     * View over a row list owned elsewhere (e.g. an index posting list)
+     */
+    TransactionView(const TransactionStore& store, const TransactionStore::RowIndex* rows, size_t count);
+
+    /**
+     * View that owns its row list (ascending rows read newest first;
+     * ranked lists such as top-K results are stored lowest rank first)
+     */
+    TransactionView(const TransactionStore& store, std::vector<TransactionStore::RowIndex> rows);
+
+    size_t size() const { return rowList ? count : last - first; }
+    bool empty() const { return size() == 0; }
+
+    /**
+     * Gets the row index of the i-th entry (0 = newest)
+     */
+    size_t rowAt(size_t index) const {
+        size_t position = size() - 1 - index;
+        return rowList ? rowList[position] : first + position;
+    }
+
+    /**
+     * Gets the i-th entry (0 = newest)
+     */
+    TransactionRef operator[](size_t index) const { return TransactionRef(*store, rowAt(index)); }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, size()); }
+
+    /**
+     * Copies the rows into independent Transaction objects (newest first)
+     */
+    std::vector<std::shared_ptr<Transaction>> materialize() const;
+};
+
+#endif // TRANSACTION_VIEW_H
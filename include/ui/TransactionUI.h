@@ -19,11 +19,12 @@ private:
 
     // Helper methods for displaying transaction data
     void displayTransactionHeader() const;
-    void displayTransactions(const std::vector<std::shared_ptr<Transaction>>& transactions) const;
+    void displayTransactions(const TransactionView& transactions) const;
     void displayMonthlySummaryHeader() const;
+    void displayQuantileRow(const std::string& label, const QuantileSketch& sketch) const;
 
     // Input validation helpers - make them const
-    bool validateDoubleInput(double& value, const std::string& prompt) const;
+    bool validateAmountInput(Money& amount, const std::string& prompt) const;
     bool validateDateInput(std::string& dateStr, const std::string& prompt) const;
     bool validateCategoryInput(std::string& category, const std::string& prompt) const;
 
@@ -48,6 +49,9 @@ public:
     void showTransactionsByMonth() const;
     void showTransactionsByAmountRange();
     void showMonthlySummary() const;
+    void showExpenseDistributionReport() const;
+    void showRollingSpendReport() const;
+    void showLargestTransactions() const;
 
     // Transaction management methods
     void addNewTransaction();
@@ -2,97 +2,166 @@
 #define DATE_UTILS_H
 
 #include <string>
+#include <string_view>
+#include <stdexcept>
 #include <ctime>
-#include <regex>
 #include <sstream>
 #include <iomanip>
 #include <chrono>
+#include <cstdint>
 
+/**
+ * Month ordinal: year * 12 + (month - 1), e.g. 2023-06 -> 24281
+ * Consecutive months map to consecutive integers.
+ */
+using MonthKey = std::int32_t;
 
+/**
+ * Day ordinal: days since 1970-01-01 for a calendar date
+ */
+using DayKey = std::int32_t;
+
+/**
+ * Calendar date fields (proleptic Gregorian)
+ */
+struct CivilDate {
+    int year;
+    int month;  // 1-12
+    int day;    // 1-31
+};
+
+/**
+ * Date helpers
+ *
+ * Ledger dates are calendar days. A date's time_t is the day ordinal times
+ * 86400 (midnight UTC of that day), so conversions between strings, time_t,
+ * day and month ordinals are plain integer arithmetic: no time zone lookups,
+ * no libc static buffers, and safe to call from any thread. Only the
+ * current*() helpers read the wall clock, in local time.
+ */
 class DateUtils {
 public:
+    static constexpr time_t SECONDS_PER_DAY = 86400;
+
+    // Default year range accepted from user input and budgets
+    static constexpr int MIN_YEAR = 1900;
+    static constexpr int MAX_YEAR = 2100;
+
     /**
-     * Validates a year-month string in YYYY-MM format
+     * Parses a YYYY-MM-DD date in a single pass without allocating
+     * Checks the layout, the year range and that the day exists in its month.
      *
-     * @param yearMonth The year-month string to validate
-     * @param minYear The minimum valid year (default: 1900)
-     * @param maxYear The maximum valid year (default: 2100)
-     * @return true if the year-month is valid, false otherwise
+     * @param text The text to parse
+     * @param date Receives the calendar date on success
+     * @param minYear The minimum valid year
+     * @param maxYear The maximum valid year
+     * @return true if the text is a valid date, false otherwise
      */
-    static bool validateYearMonth(const std::string& yearMonth, int minYear = 1900, int maxYear = 2100) {
-        // Check format with regex (YYYY-MM)
-        std::regex pattern("^([0-9]{4})-(0[1-9]|1[0-2])$");
-        if (!std::regex_match(yearMonth, pattern)) {
+    static constexpr bool parseDate(std::string_view text, CivilDate& date, int minYear = MIN_YEAR, int maxYear = MAX_YEAR) {
+        if (text.size() != 10 || text[4] != '-' || text[7] != '-') {
+            return false;
+        }
+
+        int year = 0;
+        int month = 0;
+        int day = 0;
+        if (!parseDigits(text.substr(0, 4), year) || !parseDigits(text.substr(5, 2), month) ||
+            !parseDigits(text.substr(8, 2), day)) {
             return false;
         }
 
-        // Extract year
-        int year = std::stoi(yearMonth.substr(0, 4));
+        if (year < minYear || year > maxYear || month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month)) {
+            return false;
+        }
 
-        // Check year range
-        return (year >= minYear && year <= maxYear);
+        date = CivilDate{ year, month, day };
+        return true;
     }
 
     /**
-     * Validates a date string in YYYY-MM-DD format
+     * Parses a YYYY-MM-DD date read back from stored data
+     * Stored data may predate the UI's year range (MIN_YEAR..MAX_YEAR), so
+     * only the layout and the calendar are checked; any four-digit year passes.
      *
-     * @param dateStr The date string to validate
-     * @param minYear The minimum valid year (default: 1900)
-     * @param maxYear The maximum valid year (default: 2100)
-     * @return true if the date is valid, false otherwise
+     * @param text The text to parse
+     * @param date Receives the calendar date on success
+     * @return true if the text is a valid date, false otherwise
+     */
+    static constexpr bool parseStoredDate(std::string_view text, CivilDate& date) {
+        return parseDate(text, date, 0, 9999);
+    }
+
+    /**
+     * Parses a year-month string in YYYY-MM format into a month ordinal
+     * Layout, month and year range are all checked in this one pass, so
+     * callers need no separate validateYearMonth call.
+     *
+     * @param yearMonth The year-month string
+     * @param key Receives the month ordinal on success
+     * @param minYear The minimum valid year
+     * @param maxYear The maximum valid year
+     * @return true if the string is a valid year-month, false otherwise
      */
-    static bool validateDateString(const std::string& dateStr, int minYear = 1900, int maxYear = 2100) {
-        // Check format with regex (YYYY-MM-DD)
-        std::regex pattern("^([0-9]{4})-(0[1-9]|1[0-2])-(0[1-9]|[12][0-9]|3[01])$");
-        if (!std::regex_match(dateStr, pattern)) {
+    static constexpr bool parseYearMonth(std::string_view yearMonth, MonthKey& key, int minYear = MIN_YEAR, int maxYear = MAX_YEAR) {
+        if (yearMonth.size() != 7 || yearMonth[4] != '-') {
             return false;
         }
 
-        // Extract components
-        int year = std::stoi(dateStr.substr(0, 4));
-        int month = std::stoi(dateStr.substr(5, 2));
-        int day = std::stoi(dateStr.substr(8, 2));
+        int year = 0;
+        int month = 0;
+        if (!parseDigits(yearMonth.substr(0, 4), year) || !parseDigits(yearMonth.substr(5, 2), month)) {
+            return false;
+        }
 
-        // Check year range
-        if (year < minYear || year > maxYear) {
+        if (year < minYear || year > maxYear || month < 1 || month > 12) {
             return false;
         }
 
-        // Check day validity based on month and leap year
-        int daysInMonth[] = { 0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        key = toMonthKey(year, month);
+        return true;
+    }
 
-        // Adjust for leap year
-        if (year % 400 == 0 || (year % 100 != 0 && year % 4 == 0)) {
-            daysInMonth[2] = 29;
-        }
+    /**
+     * Validates a year-month string in YYYY-MM format
+     *
+     * @param yearMonth The year-month string to validate
+     * @param minYear The minimum valid year (default: 1900)
+     * @param maxYear The maximum valid year (default: 2100)
+     * @return true if the year-month is valid, false otherwise
+     */
+    static constexpr bool validateYearMonth(std::string_view yearMonth, int minYear = MIN_YEAR, int maxYear = MAX_YEAR) {
+        MonthKey key = 0;
+        return parseYearMonth(yearMonth, key, minYear, maxYear);
+    }
 
-        return day <= daysInMonth[month];
+    /**
+     * Validates a date string in YYYY-MM-DD format
+     *
+     * @param dateStr The date string to validate
+     * @param minYear The minimum valid year (default: 1900)
+     * @param maxYear The maximum valid year (default: 2100)
+     * @return true if the date is valid, false otherwise
+     */
+    static constexpr bool validateDateString(std::string_view dateStr, int minYear = MIN_YEAR, int maxYear = MAX_YEAR) {
+        CivilDate date{};
+        return parseDate(dateStr, date, minYear, maxYear);
     }
 
     /**
      * Converts a date string in YYYY-MM-DD format to time_t
+     * Accepts the same dates as parseStoredDate.
      *
      * @param dateStr The date string to convert
-     * @return time_t value representing the date (midnight)
+     * @return time_t value representing the date (see timeFromDayKey)
+     * @throws std::invalid_argument if the text is not a valid date
      */
-    static time_t stringToTime(const std::string& dateStr) {
-        std::tm timeInfo = {};
-
-        // Extract components
-        int year = std::stoi(dateStr.substr(0, 4));
-        int month = std::stoi(dateStr.substr(5, 2));
-        int day = std::stoi(dateStr.substr(8, 2));
-
-        // Fill timeInfo structure
-        timeInfo.tm_year = year - 1900;  // Years since 1900
-        timeInfo.tm_mon = month - 1;     // Months since January (0-11)
-        timeInfo.tm_mday = day;          // Day of the month (1-31)
-        timeInfo.tm_hour = 0;            // Set to midnight
-        timeInfo.tm_min = 0;
-        timeInfo.tm_sec = 0;
+    static time_t stringToTime(std::string_view dateStr) {
+        CivilDate date{};
+        if (!parseStoredDate(dateStr, date)) {
+            throw std::invalid_argument("Invalid date: " + std::string(dateStr));
+        }
 
-        // Convert to time_t
-        return std::mktime(&timeInfo);
+        return timeFromDayKey(daysFromCivil(date.year, date.month, date.day));
     }
 
     /**
@@ -102,11 +171,7 @@ public:
      * @return Date string in YYYY-MM-DD format
      */
     static std::string timeToString(time_t time) {
-        std::tm* timeInfo = std::localtime(&time);
-
-        std::stringstream ss;
-        ss << std::put_time(timeInfo, "%Y-%m-%d");
-        return ss.str();
+        return formatDayKey(dayKeyFromTime(time));
     }
 
     /**
@@ -117,13 +182,10 @@ public:
      * @param endDate The end of the range
      * @return true if the date is within the range, false otherwise
      */
-    static bool isDateInRange(time_t date, time_t startDate, time_t endDate) {
-        // Normalize to midnight for date comparison
-        date = normalizeToMidnight(date);
-        startDate = normalizeToMidnight(startDate);
-        endDate = normalizeToMidnight(endDate);
-
-        return (date >= startDate && date <= endDate);
+    static constexpr bool isDateInRange(time_t date, time_t startDate, time_t endDate) {
+        // Compare whole days
+        DayKey day = dayKeyFromTime(date);
+        return (day >= dayKeyFromTime(startDate) && day <= dayKeyFromTime(endDate));
     }
 
     /**
@@ -133,49 +195,237 @@ public:
      * @param date2 The second date
      * @return true if the dates are in the same month and year, false otherwise
      */
-    static bool isSameMonth(time_t date1, time_t date2) {
-        std::tm* tm1 = std::localtime(&date1);
-        std::tm* tm2 = std::localtime(&date2);
+    static constexpr bool isSameMonth(time_t date1, time_t date2) {
+        return monthKeyFromTime(date1) == monthKeyFromTime(date2);
+    }
 
-        return (tm1->tm_year == tm2->tm_year && tm1->tm_mon == tm2->tm_mon);
+    /**
+     * Builds a month ordinal from a year and month
+     *
+     * @param year The calendar year
+     * @param month The month (1-12)
+     * @return Month ordinal
+     */
+    static constexpr MonthKey toMonthKey(int year, int month) {
+        return static_cast<MonthKey>(year * 12 + (month - 1));
     }
 
-    static std::string getCurrentDateStr() {
-        auto now = std::chrono::system_clock::now();
-        auto time_t_now = std::chrono::system_clock::to_time_t(now);
+    static constexpr int monthKeyYear(MonthKey key) {
+        return key / 12;
+    }
 
-        std::tm local_tm;
+    static constexpr int monthKeyMonth(MonthKey key) {
+        return key % 12 + 1;
+    }
 
-#ifdef _WIN32
-        localtime_s(&local_tm, &time_t_now);
-#else
-        localtime_r(&time_t_now, &local_tm);
-#endif
+    /**
+     * Formats a month ordinal as YYYY-MM
+     *
+     * @param key The month ordinal
+     * @return Year-month string
+     */
+    static std::string formatMonthKey(MonthKey key) {
+        int year = monthKeyYear(key);
+        if (year < 0 || year > 9999) {
+            std::ostringstream oss;
+            oss << year << "-" << std::setw(2) << std::setfill('0') << monthKeyMonth(key);
+            return oss.str();
+        }
 
-        std::ostringstream oss;
-        oss << std::put_time(&local_tm, "%Y-%m-%d");
-        return oss.str();
+        std::string text = "0000-00";
+        writeDigits(text, 0, year, 4);
+        writeDigits(text, 5, monthKeyMonth(key), 2);
+        return text;
+    }
+
+    static constexpr bool isLeapYear(int year) {
+        return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    }
+
+    static constexpr int daysInMonth(int year, int month) {
+        constexpr int lengths[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        return (month == 2 && isLeapYear(year)) ? 29 : lengths[month - 1];
+    }
+
+    /**
+     * Converts a calendar date to a day ordinal
+     *
+     * @param year The calendar year
+     * @param month The month (1-12)
+     * @param day The day of the month (1-31)
+     * @return Days since 1970-01-01
+     */
+    static constexpr DayKey daysFromCivil(int year, int month, int day) {
+        // Shift the year so it starts in March; leap days then fall at the end
+        year -= (month <= 2) ? 1 : 0;
+        const int era = (year >= 0 ? year : year - 399) / 400;
+        const int yearOfEra = year - era * 400;
+        const int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        const int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        return static_cast<DayKey>(era * 146097 + dayOfEra - 719468);
     }
 
-private:
     /**
-     * Normalizes a time_t value to midnight (00:00:00) of the day
+     * Converts a day ordinal back to a calendar date (inverse of daysFromCivil)
      *
-     * @param time The time_t value to normalize
-     * @return Normalized time_t value
+     * @param key Days since 1970-01-01
+     * @return Calendar date
+     */
+    static constexpr CivilDate civilFromDays(DayKey key) {
+        const int shifted = static_cast<int>(key) + 719468;
+        const int era = (shifted >= 0 ? shifted : shifted - 146096) / 146097;
+        const int dayOfEra = shifted - era * 146097;
+        const int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+        const int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+        const int shiftedMonth = (5 * dayOfYear + 2) / 153;
+        const int day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+        const int month = shiftedMonth + (shiftedMonth < 10 ? 3 : -9);
+        return CivilDate{ yearOfEra + era * 400 + (month <= 2 ? 1 : 0), month, day };
+    }
+
+    /**
+     * Gets the month ordinal of a day ordinal
+     */
+    static constexpr MonthKey monthKeyFromDayKey(DayKey key) {
+        CivilDate date = civilFromDays(key);
+        return toMonthKey(date.year, date.month);
+    }
+
+    /**
+     * Gets the time_t that represents a day (its midnight, UTC)
      */
-    static time_t normalizeToMidnight(time_t time) {
-        std::tm* timeInfo = std::localtime(&time);
+    static constexpr time_t timeFromDayKey(DayKey key) {
+        return static_cast<time_t>(key) * SECONDS_PER_DAY;
+    }
 
-        // Set time to midnight
-        timeInfo->tm_hour = 0;
-        timeInfo->tm_min = 0;
-        timeInfo->tm_sec = 0;
+    /**
+     * Gets the day a time_t falls on (floor division, so earlier times round down)
+     *
+     * @param time The time_t value
+     * @return Day ordinal
+     */
+    static constexpr DayKey dayKeyFromTime(time_t time) {
+        time_t days = time / SECONDS_PER_DAY;
+        if (time % SECONDS_PER_DAY < 0) {
+            --days;
+        }
+        return static_cast<DayKey>(days);
+    }
 
-        // Convert back to time_t
-        return std::mktime(timeInfo);
+    /**
+     * Gets the month ordinal a time_t falls in
+     *
+     * @param time The time_t value
+     * @return Month ordinal
+     */
+    static constexpr MonthKey monthKeyFromTime(time_t time) {
+        return monthKeyFromDayKey(dayKeyFromTime(time));
+    }
+
+    /**
+     * Formats a day ordinal as YYYY-MM-DD
+     *
+     * @param key Days since 1970-01-01
+     * @return Date string
+     */
+    static std::string formatDayKey(DayKey key) {
+        CivilDate date = civilFromDays(key);
+        if (date.year < 0 || date.year > 9999) {
+            std::ostringstream oss;
+            oss << date.year << "-" << std::setw(2) << std::setfill('0') << date.month
+                << "-" << std::setw(2) << std::setfill('0') << date.day;
+            return oss.str();
+        }
+
+        std::string text = "0000-00-00";
+        writeDigits(text, 0, date.year, 4);
+        writeDigits(text, 5, date.month, 2);
+        writeDigits(text, 8, date.day, 2);
+        return text;
+    }
+
+    /**
+     * Gets today's date (local wall clock) as a day ordinal
+     */
+    static DayKey currentDayKey() {
+        std::tm timeInfo = toLocalTime(std::time(nullptr));
+        return daysFromCivil(timeInfo.tm_year + 1900, timeInfo.tm_mon + 1, timeInfo.tm_mday);
+    }
+
+    /**
+     * Gets the current month (local wall clock) as a month ordinal
+     */
+    static MonthKey currentMonthKey() {
+        return monthKeyFromDayKey(currentDayKey());
+    }
+
+    static std::string getCurrentDateStr() {
+        return formatDayKey(currentDayKey());
+    }
+
+private:
+    // Reads a run of decimal digits; false if any character is not a digit
+    static constexpr bool parseDigits(std::string_view digits, int& value) {
+        int result = 0;
+        for (char c : digits) {
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            result = result * 10 + (c - '0');
+        }
+        value = result;
+        return true;
+    }
+
+    // Writes a non-negative value as fixed-width digits in place
+    static void writeDigits(std::string& text, size_t position, int value, int width) {
+        for (int index = width - 1; index >= 0; --index) {
+            text[position + static_cast<size_t>(index)] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+    }
+
+    /**
+     * Thread-safe conversion of a wall-clock time_t to local calendar fields
+     */
+    static std::tm toLocalTime(time_t time) {
+        std::tm timeInfo{};
+
+#ifdef _WIN32
+        localtime_s(&timeInfo, &time);
+#else
+        localtime_r(&time, &timeInfo);
+#endif
+
+        return timeInfo;
     }
 
 };
 
+// Compile-time checks of the parser and the civil-date conversions
+static_assert(DateUtils::validateDateString("2024-02-29"));
+static_assert(!DateUtils::validateDateString("2023-02-29"));
+static_assert(!DateUtils::validateDateString("2100-02-29"));
+static_assert(DateUtils::validateDateString("2000-02-29"));
+static_assert(!DateUtils::validateDateString("2023-04-31"));
+static_assert(!DateUtils::validateDateString("2023-00-10"));
+static_assert(!DateUtils::validateDateString("2023-13-01"));
+static_assert(!DateUtils::validateDateString("2023-1-01"));
+static_assert(!DateUtils::validateDateString("2023-01-01 "));
+static_assert(!DateUtils::validateDateString("2023/01/01"));
+static_assert(!DateUtils::validateDateString("+023-01-01"));
+static_assert(!DateUtils::validateDateString("1899-12-31"));
+static_assert(DateUtils::validateDateString("1899-12-31", 0, 9999));
+static_assert([] { CivilDate date{}; return DateUtils::parseStoredDate("0202-01-01", date) && date.year == 202; }());
+static_assert([] { CivilDate date{}; return !DateUtils::parseStoredDate("2023-02-29", date); }());
+static_assert(DateUtils::validateYearMonth("2023-06"));
+static_assert(!DateUtils::validateYearMonth("2023-6"));
+static_assert(!DateUtils::validateYearMonth("2023-00"));
+static_assert(!DateUtils::validateYearMonth("2101-01"));
+static_assert(!DateUtils::validateYearMonth("2023-06-01"));
+static_assert(DateUtils::daysFromCivil(1970, 1, 1) == 0);
+static_assert(DateUtils::daysFromCivil(2000, 3, 1) == 11017);
+static_assert(DateUtils::civilFromDays(11016).day == 29);
+static_assert(DateUtils::monthKeyFromTime(-1) == DateUtils::toMonthKey(1969, 12));
+
 #endif // DATE_UTILS_H
\ No newline at end of file
@@ -2,11 +2,15 @@
 #define FILE_UTILS_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <cstring>
 #include <cerrno> 
 
 // Include appropriate headers for directory operations
@@ -18,7 +22,10 @@
 #endif
 
 #include "../models/Transaction.h"
+#include "../services/TransactionView.h"
+#include "../services/ParallelAggregator.h"
 #include "DateUtils.h"
+#include "MappedFile.h"
 #include <sys/stat.h>
 
 class FileUtils {
@@ -73,62 +80,202 @@ public:
     /**
      * Loads transactions from a CSV file
      *
+     * The file is memory-mapped and each line is split into fields in place;
+     * amounts, dates and types are decoded straight from the mapped bytes.
+     * Rows are built into one shared block, so loading costs a single
+     * allocation for the transactions rather than one per row.
+     *
      * @param filePath The path to the CSV file
      * @return LoadResult containing loaded transactions and any errors
      */
     static LoadResult loadTransactionsFromCSV(const std::string& filePath) {
         LoadResult result;
-        std::ifstream file(filePath);
+        MappedFile file(filePath);
 
-        if (!file.is_open()) {
+        if (!file.isOpen()) {
             result.errors.push_back({ 0, "Failed to open file: " + filePath });
             return result;
         }
 
-        std::string line;
-        int lineNum = 0;
+        std::vector<Transaction> rows;
+        parseTransactionLines(file.contents(), 1, rows, result);
+        result.transactions = shareRows(std::move(rows));
+        return result;
+    }
 
-        // Read and process each line
-        while (std::getline(file, line)) {
-            lineNum++;
-            result.totalLines++;
+    // Smallest byte range worth parsing on its own thread
+    static const size_t PARSE_CHUNK_BYTES = 1 << 16;
 
-            // Skip empty lines
-            if (line.empty()) {
-                continue;
-            }
+    /**
+     * Loads transactions from a CSV file, parsing chunks of it concurrently
+     *
+     * The mapped file is split into byte ranges; each chunk owns the lines
+     * that start inside it and is parsed on its own thread into its own rows
+     * and errors. Chunks are stitched back in file order, renumbering error
+     * lines by the line counts of the chunks before them, so the result is
+     * identical to the single-threaded loader.
+     *
+     * @param filePath The path to the CSV file
+     * @param aggregator Supplies the worker count and chunking
+     * @return LoadResult containing loaded transactions (in file order) and any errors
+     */
+    static LoadResult loadTransactionsFromCSV(const std::string& filePath, const ParallelAggregator& aggregator) {
+        MappedFile file(filePath);
+
+        if (!file.isOpen()) {
+            LoadResult result;
+            result.errors.push_back({ 0, "Failed to open file: " + filePath });
+            return result;
+        }
 
-            try {
-                // Parse CSV line: amount,date,category,type
-                std::stringstream ss(line);
-                std::string amountStr, dateStr, category, typeStr;
-
-                // Read CSV fields
-                if (!std::getline(ss, amountStr, ',') ||
-                    !std::getline(ss, dateStr, ',') ||
-                    !std::getline(ss, category, ',') ||
-                    !std::getline(ss, typeStr)) {
-                    throw std::runtime_error("Invalid CSV format - missing fields");
+        const std::string_view text = file.contents();
+        ParsedChunk parsed = aggregator.reduce<ParsedChunk>(0, text.size(), PARSE_CHUNK_BYTES,
+            [text](size_t first, size_t end) {
+                size_t start = alignToLineStart(text, first);
+                size_t stop = alignToLineStart(text, end);
+
+                ParsedChunk chunk;
+                if (start < stop) {
+                    parseTransactionLines(text.substr(start, stop - start), 1, chunk.rows, chunk.status);
+                }
+                return chunk;
+            },
+            [](ParsedChunk& into, ParsedChunk&& next) {
+                // Line numbers in the next chunk continue from this one
+                const int lineOffset = into.status.totalLines;
+                for (auto& error : next.status.errors) {
+                    into.status.errors.push_back({ error.first + lineOffset, std::move(error.second) });
                 }
+                for (auto& failed : next.status.failedLines) {
+                    into.status.failedLines.push_back({ failed.first + lineOffset, std::move(failed.second) });
+                }
+                into.status.totalLines += next.status.totalLines;
 
-                // Parse transaction data
-                double amount = std::stod(amountStr);
-                time_t date = DateUtils::stringToTime(dateStr);
-                TransactionType type = (typeStr == "INCOME") ?
-                    TransactionType::INCOME :
-                    TransactionType::EXPENSE;
+                into.rows.insert(into.rows.end(), next.rows.begin(), next.rows.end());
+            });
 
-                // Create and add transaction
-                auto transaction = std::make_shared<Transaction>(amount, date, category, type);
-                result.transactions.push_back(transaction);
+        LoadResult result = std::move(parsed.status);
+        result.transactions = shareRows(std::move(parsed.rows));
+        return result;
+    }
+
+    // Rows handed to a streaming callback at a time, by default
+    static const size_t DEFAULT_STREAM_BATCH = 4096;
+
+    // Read size for streaming; grows only for a line longer than this
+    static const size_t STREAM_BUFFER_SIZE = 1 << 20;
+
+    /**
+     * Streams transactions from a CSV file in fixed-size batches
+     *
+     * The file is read through a fixed buffer and rows are handed out as
+     * they are parsed, so memory use does not depend on the file's size.
+     * Use this to aggregate large exports without building a ledger.
+     *
+     * @param filePath The path to the CSV file
+     * @param batchSize Rows per batch (the last batch may be smaller)
+     * @param onBatch Called as onBatch(const std::vector<Transaction>&) for each batch, in file order
+     * @param onError Called as onError(lineNumber, message, lineText) for each rejected line
+     * @return LoadResult with totalLines set (and a line-0 error if the file cannot be opened or
+     *         reading fails part-way, in which case only the rows before it were handed out); no transactions
+     */
+    template <typename BatchFn, typename ErrorFn>
+    static LoadResult streamTransactionsFromCSV(const std::string& filePath, size_t batchSize,
+        BatchFn onBatch, ErrorFn onError) {
+        LoadResult result;
+        std::ifstream file(filePath, std::ios::binary);
+
+        if (!file.is_open()) {
+            result.errors.push_back({ 0, "Failed to open file: " + filePath });
+            return result;
+        }
+
+        batchSize = std::max<size_t>(batchSize, 1);
+        std::vector<char> buffer(STREAM_BUFFER_SIZE);
+        std::vector<Transaction> rows;
+        std::vector<Transaction> batch;
+        batch.reserve(batchSize);
+        size_t carried = 0;   // Bytes of an unfinished line kept at the buffer's front
+
+        while (true) {
+            file.read(buffer.data() + carried, static_cast<std::streamsize>(buffer.size() - carried));
+            size_t filled = carried + static_cast<size_t>(file.gcount());
+
+            // A short read sets eof and fail together; fail alone (or bad) is an I/O error,
+            // which must not pass for the end of a truncated file
+            if (file.bad() || (file.fail() && !file.eof())) {
+                result.errors.push_back({ 0, "Read error in " + filePath });
+                return result;
             }
-            catch (const std::exception& e) {
-                result.errors.push_back({ lineNum, std::string("Error parsing line: ") + e.what() });
-                result.failedLines.push_back({ lineNum, line });
+            bool atEnd = file.eof();
+
+            // Parse up to the last complete line; at end of file, everything
+            std::string_view text(buffer.data(), filled);
+            size_t parseEnd = filled;
+            if (!atEnd) {
+                size_t lastNewline = text.rfind('\n');
+                if (lastNewline == std::string_view::npos) {
+                    // A single line longer than the buffer; grow and keep reading
+                    carried = filled;
+                    buffer.resize(buffer.size() * 2);
+                    continue;
+                }
+                parseEnd = lastNewline + 1;
+            }
+
+            LoadResult chunk;
+            parseTransactionLines(text.substr(0, parseEnd), result.totalLines + 1, rows, chunk);
+            result.totalLines += chunk.totalLines;
+            for (size_t index = 0; index < chunk.errors.size(); ++index) {
+                onError(chunk.errors[index].first, chunk.errors[index].second, chunk.failedLines[index].second);
+            }
+
+            // Move the buffer's rows into the batch, handing it out each time it fills
+            for (Transaction& row : rows) {
+                batch.push_back(std::move(row));
+                if (batch.size() == batchSize) {
+                    onBatch(static_cast<const std::vector<Transaction>&>(batch));
+                    batch.clear();
+                }
+            }
+            rows.clear();
+
+            if (atEnd) {
+                if (!batch.empty()) {
+                    onBatch(static_cast<const std::vector<Transaction>&>(batch));
+                }
+                break;
             }
+
+            carried = filled - parseEnd;
+            std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(parseEnd),
+                buffer.begin() + static_cast<std::ptrdiff_t>(filled), buffer.begin());
         }
 
-        file.close();
+        return result;
+    }
+
+    /**
+     * Streams transactions from a CSV file, collecting errors in the result
+     *
+     * @param filePath The path to the CSV file
+     * @param batchSize Rows per batch (the last batch may be smaller)
+     * @param onBatch Called as onBatch(const std::vector<Transaction>&) for each batch, in file order
+     * @return LoadResult with totalLines and per-line errors; no transactions
+     */
+    template <typename BatchFn>
+    static LoadResult streamTransactionsFromCSV(const std::string& filePath, size_t batchSize, BatchFn onBatch) {
+        std::vector<std::pair<int, std::string>> errors;
+        std::vector<std::pair<int, std::string>> failedLines;
+
+        LoadResult result = streamTransactionsFromCSV(filePath, batchSize, onBatch,
+            [&](int lineNumber, const std::string& message, const std::string& lineText) {
+                errors.push_back({ lineNumber, message });
+                failedLines.push_back({ lineNumber, lineText });
+            });
+
+        result.errors.insert(result.errors.end(), errors.begin(), errors.end());
+        result.failedLines.insert(result.failedLines.end(), failedLines.begin(), failedLines.end());
         return result;
     }
 
@@ -151,12 +298,32 @@ public:
 
         // Write each transaction as a CSV line
         for (const auto& t : transactions) {
-            file << t->getAmount() << ","
-                << DateUtils::timeToString(t->getDate()) << ","
-                << t->getCategory() << ","
-                << (t->getType() == TransactionType::INCOME ? "INCOME" : "EXPENSE")
-                << std::endl;
+            writeTransactionRow(file, *t);
+            count++;
+        }
 
+        file.close();
+        return count;
+    }
+
+    /**
+     * Saves the rows of a view to a CSV file without materializing them
+     *
+     * @param transactions The view to save
+     * @param filePath The path to the CSV file
+     * @return The number of transactions saved
+     */
+    static int saveTransactionsToCSV(const TransactionView& transactions, const std::string& filePath) {
+        std::ofstream file(filePath);
+
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open file for writing: " + filePath);
+        }
+
+        int count = 0;
+
+        for (const TransactionRef t : transactions) {
+            writeTransactionRow(file, t);
             count++;
         }
 
@@ -326,6 +493,139 @@ public:
 
         return tokens;
     }
+
+private:
+    // Rows and errors parsed from one chunk of a file
+    struct ParsedChunk {
+        std::vector<Transaction> rows;
+        LoadResult status;
+    };
+
+    // Moves a byte offset forward to the start of the next line (unless already at one)
+    static size_t alignToLineStart(std::string_view text, size_t offset) {
+        if (offset == 0 || offset >= text.size()) {
+            return std::min(offset, text.size());
+        }
+        if (text[offset - 1] == '\n') {
+            return offset;
+        }
+
+        size_t newline = text.find('\n', offset);
+        return (newline == std::string_view::npos) ? text.size() : newline + 1;
+    }
+
+    /**
+     * Parses CSV lines (amount,date,category,type) into rows
+     * Line numbering, skipped empty lines and error messages match the
+     * original getline-based loader; a trailing '\r' is ignored.
+     *
+     * @param text The lines to parse
+     * @param firstLineNumber Line number of the first line in text
+     * @param rows Receives the parsed rows
+     * @param result Receives line counts and per-line errors
+     */
+    static void parseTransactionLines(std::string_view text, int firstLineNumber,
+        std::vector<Transaction>& rows, LoadResult& result) {
+        // Category names repeat heavily; resolve each distinct one once
+        std::unordered_map<std::string_view, CategoryId> categoryIds;
+
+        // Rough guess at the row count to avoid regrowing (~40 bytes a line)
+        rows.reserve(rows.size() + text.size() / 40);
+
+        int lineNum = firstLineNumber - 1;
+        size_t pos = 0;
+        while (pos < text.size()) {
+            const char* newline = static_cast<const char*>(std::memchr(text.data() + pos, '\n', text.size() - pos));
+            size_t lineEnd = newline ? static_cast<size_t>(newline - text.data()) : text.size();
+            std::string_view line = text.substr(pos, lineEnd - pos);
+            pos = lineEnd + 1;
+
+            lineNum++;
+            result.totalLines++;
+
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+
+            // Skip empty lines
+            if (line.empty()) {
+                continue;
+            }
+
+            std::string error = parseTransactionLine(line, rows, categoryIds);
+            if (!error.empty()) {
+                result.errors.push_back({ lineNum, "Error parsing line: " + error });
+                result.failedLines.push_back({ lineNum, std::string(line) });
+            }
+        }
+    }
+
+    /**
+     * Parses one non-empty CSV line and appends the row
+     *
+     * @return Empty on success, otherwise the reason the line was rejected
+     */
+    static std::string parseTransactionLine(std::string_view line, std::vector<Transaction>& rows,
+        std::unordered_map<std::string_view, CategoryId>& categoryIds) {
+        // amount,date,category,type; the type is the rest of the line
+        size_t firstComma = line.find(',');
+        size_t secondComma = (firstComma == std::string_view::npos) ? firstComma : line.find(',', firstComma + 1);
+        size_t thirdComma = (secondComma == std::string_view::npos) ? secondComma : line.find(',', secondComma + 1);
+        if (thirdComma == std::string_view::npos || thirdComma + 1 == line.size()) {
+            return "Invalid CSV format - missing fields";
+        }
+
+        std::string_view amountField = line.substr(0, firstComma);
+        std::string_view dateField = line.substr(firstComma + 1, secondComma - firstComma - 1);
+        std::string_view categoryField = line.substr(secondComma + 1, thirdComma - secondComma - 1);
+        std::string_view typeField = line.substr(thirdComma + 1);
+
+        Money amount;
+        if (!Money::parse(amountField, amount)) {
+            return "Invalid amount: '" + std::string(amountField) + "'";
+        }
+
+        CivilDate date{};
+        if (!DateUtils::parseStoredDate(dateField, date)) {
+            return "Invalid date: " + std::string(dateField);
+        }
+
+        auto category = categoryIds.find(categoryField);
+        if (category == categoryIds.end()) {
+            CategoryId id = CategoryDictionary::instance().intern(std::string(categoryField));
+            category = categoryIds.emplace(categoryField, id).first;
+        }
+
+        TransactionType type = (typeField == "INCOME") ?
+            TransactionType::INCOME :
+            TransactionType::EXPENSE;
+
+        rows.emplace_back(amount, DateUtils::timeFromDayKey(DateUtils::daysFromCivil(date.year, date.month, date.day)),
+            category->second, type);
+        return std::string();
+    }
+
+    // Hands out pointers into one shared block of rows (aliasing shared_ptrs)
+    static std::vector<std::shared_ptr<Transaction>> shareRows(std::vector<Transaction>&& rows) {
+        auto block = std::make_shared<std::vector<Transaction>>(std::move(rows));
+
+        std::vector<std::shared_ptr<Transaction>> transactions;
+        transactions.reserve(block->size());
+        for (Transaction& row : *block) {
+            transactions.emplace_back(block, &row);
+        }
+        return transactions;
+    }
+
+    // Writes one CSV line; works for Transaction and TransactionRef alike
+    template <typename Row>
+    static void writeTransactionRow(std::ofstream& file, const Row& t) {
+        file << t.getAmount().toString() << ","
+            << DateUtils::timeToString(t.getDate()) << ","
+            << t.getCategory() << ","
+            << (t.getType() == TransactionType::INCOME ? "INCOME" : "EXPENSE")
+            << std::endl;
+    }
 };
 
 #endif // FILE_UTILS_H
\ No newline at end of file
@@ -0,0 +1,150 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Read-only memory mapping of a whole file
+ *
+ * The contents are exposed as one string_view, so parsers can scan fields
+ * in place without copying lines into strings. The mapping is released
+ * when the object is destroyed; views into it must not outlive it.
+ */
+class MappedFile {
+private:
+    const char* data = nullptr;
+    size_t size = 0;
+    bool opened = false;
+
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+#endif
+
+    void close() {
+#ifdef _WIN32
+        if (data) {
+            UnmapViewOfFile(data);
+        }
+        if (mappingHandle) {
+            CloseHandle(mappingHandle);
+        }
+        if (fileHandle != INVALID_HANDLE_VALUE) {
+            CloseHandle(fileHandle);
+        }
+        mappingHandle = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (data) {
+            munmap(const_cast<char*>(data), size);
+        }
+#endif
+        data = nullptr;
+        size = 0;
+        opened = false;
+    }
+
+public:
+    /**
+     * Maps a file for reading
+     *
+     * @param filePath The path to the file
+     */
+    explicit MappedFile(const std::string& filePath) {
+#ifdef _WIN32
+        fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize)) {
+            close();
+            return;
+        }
+
+        // An empty file cannot be mapped but is still a valid, empty input
+        opened = true;
+        size = static_cast<size_t>(fileSize.QuadPart);
+        if (size == 0) {
+            return;
+        }
+
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mappingHandle) {
+            close();
+            return;
+        }
+        data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (!data) {
+            close();
+        }
+#else
+        int descriptor = ::open(filePath.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            return;
+        }
+
+        struct stat info;
+        if (fstat(descriptor, &info) != 0) {
+            ::close(descriptor);
+            return;
+        }
+
+        // An empty file cannot be mapped but is still a valid, empty input
+        opened = true;
+        size = static_cast<size_t>(info.st_size);
+        if (size > 0) {
+            void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapped == MAP_FAILED) {
+                size = 0;
+                opened = false;
+            }
+            else {
+                data = static_cast<const char*>(mapped);
+                // The file is read front to back once
+                madvise(mapped, size, MADV_SEQUENTIAL);
+            }
+        }
+
+        // The mapping stays valid after the descriptor is closed
+        ::close(descriptor);
+#endif
+    }
+
+    ~MappedFile() {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @return true if the file was opened and mapped (or is empty)
+     */
+    bool isOpen() const { return opened; }
+
+    /**
+     * @return The whole file contents
+     */
+    std::string_view contents() const {
+        return data ? std::string_view(data, size) : std::string_view();
+    }
+};
+
+#endif // MAPPED_FILE_H
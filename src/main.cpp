@@ -198,8 +198,9 @@ int main(int argc, char* argv[]) {
                     "6. View Transactions By Month\n"
                     "7. View Monthly Summary\n"
                     "8. Add New Transaction\n"
+                    "9. Largest Transactions\n"
                     "0. Back to Main Menu\n"
-                    "Enter your choice (0-8): ";
+                    "Enter your choice (0-9): ";
                 if (!(std::cin >> tChoice)) {
                     std::cin.clear();
                     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -219,7 +220,8 @@ int main(int argc, char* argv[]) {
                 case 6: transactionUI->showTransactionsByMonth(); break;
                 case 7: transactionUI->showMonthlySummary(); break;
                 case 8: transactionUI->addNewTransaction(); break;
-                default: std::cout << "Invalid choice (0-8).\n";
+                case 9: transactionUI->showLargestTransactions(); break;
+                default: std::cout << "Invalid choice (0-9).\n";
                 }
             } while (tChoice != 0);
             break;
@@ -289,8 +291,10 @@ int main(int argc, char* argv[]) {
                 << ") =====\n";
             std::cout << "1. Monthly Summary\n"
                 "2. Budget Utilization Report\n"
+                "3. Expense Size Distribution\n"
+                "4. Rolling Spend (7/30/90 days)\n"
                 "0. Back to Main Menu\n"
-                "Enter your choice (0-2): ";
+                "Enter your choice (0-4): ";
             if (!(std::cin >> rChoice)) {
                 std::cin.clear();
                 std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -309,8 +313,14 @@ int main(int argc, char* argv[]) {
             case 2:
                 budgetUI->showBudgetUsageReport();
                 break;
+            case 3:
+                transactionUI->showExpenseDistributionReport();
+                break;
+            case 4:
+                transactionUI->showRollingSpendReport();
+                break;
             default:
-                std::cout << "Invalid choice. Please try again (0-2).\n";
+                std::cout << "Invalid choice. Please try again (0-4).\n";
             }
 
             break;
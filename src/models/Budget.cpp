@@ -2,36 +2,44 @@
 #include <iostream>
 
 // Default constructor
-Budget::Budget() : category(""), yearMonth(""), limitAmount(0.0) {}
+Budget::Budget() : categoryId(CategoryDictionary::instance().intern("")), monthKey(0), limitAmount() {}
 
 // Parameterized constructor
-Budget::Budget(const std::string& category, const std::string& yearMonth, double limitAmount)
-    : category(category), yearMonth(yearMonth), limitAmount(limitAmount) {
+Budget::Budget(const std::string& category, MonthKey monthKey, Money limitAmount)
+    : categoryId(CategoryDictionary::instance().intern(category)), monthKey(monthKey), limitAmount(limitAmount) {
 }
 
 // Getters and Setters
 std::string Budget::getCategory() const {
-    return category;
+    return CategoryDictionary::instance().getName(categoryId);
 }
 
 void Budget::setCategory(const std::string& category) {
-    this->category = category;
+    categoryId = CategoryDictionary::instance().intern(category);
 }
 
-std::string Budget::getYearMonth() const {
-    return yearMonth;
+CategoryId Budget::getCategoryId() const {
+    return categoryId;
+}
+
+MonthKey Budget::getMonthKey() const {
+    return monthKey;
 }
 
-void Budget::setYearMonth(const std::string& yearMonth) {
-    this->yearMonth = yearMonth;
+void Budget::setMonthKey(MonthKey monthKey) {
+    this->monthKey = monthKey;
+}
+
+std::string Budget::getYearMonth() const {
+    return DateUtils::formatMonthKey(monthKey);
 }
 
-double Budget::getLimitAmount() const {
+Money Budget::getLimitAmount() const {
     return limitAmount;
 }
 
-void Budget::setLimitAmount(double limitAmount) {
-    if (limitAmount < 0) {
+void Budget::setLimitAmount(Money limitAmount) {
+    if (limitAmount < Money()) {
         throw std::invalid_argument("Budget limit amount cannot be negative");
     }
     this->limitAmount = limitAmount;
@@ -39,14 +47,12 @@ void Budget::setLimitAmount(double limitAmount) {
 
 // Format the limit amount with "$" symbol and 2 decimal places
 std::string Budget::getFormattedAmount() const {
-    std::ostringstream oss;
-    oss << "$" << std::fixed << std::setprecision(2) << limitAmount;
-    return oss.str();
+    return "$" + limitAmount.toString();
 }
 
 // Get a displayable string representation
 std::string Budget::getDisplayString() const {
-    return "Category: " + category + ", Month: " + yearMonth + ", Limit: " + getFormattedAmount();
+    return "Category: " + getCategory() + ", Month: " + getYearMonth() + ", Limit: " + getFormattedAmount();
 }
 
 // Static method to create a valid year-month string
@@ -56,12 +62,11 @@ std::string Budget::createYearMonthString(int year, int month) {
         throw std::invalid_argument("Month must be between 1 and 12");
     }
 
-    // Validate year (basic sanity check)
-    if (year < 1900 || year > 2100) {
-        throw std::invalid_argument("Year must be between 1900 and 2100");
+    // Validate year (same range the year-month parser accepts)
+    if (year < DateUtils::MIN_YEAR || year > DateUtils::MAX_YEAR) {
+        throw std::invalid_argument("Year must be between " + std::to_string(DateUtils::MIN_YEAR) +
+            " and " + std::to_string(DateUtils::MAX_YEAR));
     }
 
-    std::ostringstream oss;
-    oss << year << "-" << std::setw(2) << std::setfill('0') << month;
-    return oss.str();
+    return DateUtils::formatMonthKey(DateUtils::toMonthKey(year, month));
 }
\ No newline at end of file
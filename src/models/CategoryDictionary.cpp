@@ -0,0 +1,67 @@
+#include "../../include/models/CategoryDictionary.h"
+#include <mutex>
+#include <stdexcept>
+
+CategoryDictionary& CategoryDictionary::instance() {
+    static CategoryDictionary dictionary;
+    return dictionary;
+}
+
+CategoryId CategoryDictionary::intern(const std::string& name) {
+    {
+        std::shared_lock<std::shared_mutex> readLock(mutex);
+        auto it = lookup.find(name);
+        if (it != lookup.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> writeLock(mutex);
+
+    // Another thread may have added it between the two locks
+    auto it = lookup.find(name);
+    if (it != lookup.end()) {
+        return it->second;
+    }
+
+    CategoryId id = static_cast<CategoryId>(names.size());
+    names.push_back(name);
+    lookup.emplace(name, id);
+    return id;
+}
+
+bool CategoryDictionary::find(const std::string& name, CategoryId& id) const {
+    std::shared_lock<std::shared_mutex> readLock(mutex);
+    auto it = lookup.find(name);
+    if (it == lookup.end()) {
+        return false;
+    }
+
+    id = it->second;
+    return true;
+}
+
+std::string CategoryDictionary::getName(CategoryId id) const {
+    std::shared_lock<std::shared_mutex> readLock(mutex);
+    if (id >= names.size()) {
+        throw std::out_of_range("Unknown category id: " + std::to_string(id));
+    }
+    return names[id];
+}
+
+bool CategoryDictionary::rename(CategoryId id, const std::string& newName) {
+    std::unique_lock<std::shared_mutex> writeLock(mutex);
+    if (id >= names.size() || lookup.find(newName) != lookup.end()) {
+        return false;
+    }
+
+    lookup.erase(names[id]);
+    names[id] = newName;
+    lookup.emplace(newName, id);
+    return true;
+}
+
+size_t CategoryDictionary::size() const {
+    std::shared_lock<std::shared_mutex> readLock(mutex);
+    return names.size();
+}
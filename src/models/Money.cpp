@@ -0,0 +1,115 @@
+#include "../../include/models/Money.h"
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+bool Money::tryFromDouble(double value, Money& amount) {
+    // Values whose cents do not fit in 64 bits (e.g. 1e18) are rejected, not
+    // rounded to an unspecified count; 2^63 itself is out of range and the
+    // comparison is false for NaN and infinities
+    const double scaledCents = value * 100.0;
+    if (!(std::fabs(scaledCents) < 9223372036854775808.0)) {
+        return false;
+    }
+    amount = Money(static_cast<std::int64_t>(std::llround(scaledCents)));
+    return true;
+}
+
+Money Money::fromString(const std::string& text) {
+    Money amount;
+    if (!parse(text, amount)) {
+        throw std::invalid_argument("Invalid amount: '" + text + "'");
+    }
+    return amount;
+}
+
+bool Money::parse(std::string_view text, Money& amount) {
+    const char* const first = text.data();
+    const char* const last = first + text.size();
+    const char* pos = first;
+    bool negative = false;
+
+    if (pos != last && (*pos == '-' || *pos == '+')) {
+        negative = (*pos == '-');
+        pos++;
+    }
+
+    std::int64_t whole = 0;
+    const char* wholeEnd = pos;
+    bool wholeFits = true;
+    if (pos != last && *pos >= '0' && *pos <= '9') {
+        auto [end, error] = std::from_chars(pos, last, whole);
+        wholeFits = (error == std::errc());
+        wholeEnd = end;
+        // from_chars stops at the first non-digit either way
+        while (wholeEnd != last && *wholeEnd >= '0' && *wholeEnd <= '9') {
+            wholeEnd++;
+        }
+    }
+    size_t wholeDigits = static_cast<size_t>(wholeEnd - pos);
+    pos = wholeEnd;
+
+    std::int64_t fraction = 0;
+    size_t fractionDigits = 0;
+    if (pos != last && *pos == '.') {
+        pos++;
+        while (pos != last && *pos >= '0' && *pos <= '9') {
+            if (fractionDigits < 2) {
+                fraction = fraction * 10 + (*pos - '0');
+            }
+            fractionDigits++;
+            pos++;
+        }
+    }
+
+    if (wholeDigits == 0 && fractionDigits == 0) {
+        return false;
+    }
+
+    // Anything else (exponents, more than two decimals, trailing text) is
+    // rounded through a floating-point parse for compatibility with older files
+    if (pos != last || fractionDigits > 2 || wholeDigits > 16 || !wholeFits) {
+        // from_chars takes no leading '+'
+        const char* numberStart = (first != last && *first == '+') ? first + 1 : first;
+        double value = 0.0;
+        auto [end, error] = std::from_chars(numberStart, last, value);
+        if (error != std::errc() || end != last || (numberStart != first && *numberStart == '-')) {
+            return false;
+        }
+        return tryFromDouble(value, amount);
+    }
+
+    if (fractionDigits == 1) {
+        fraction *= 10;
+    }
+
+    std::int64_t total = whole * 100 + fraction;
+    amount = Money(negative ? -total : total);
+    return true;
+}
+
+Money Money::dividedBy(std::int64_t divisor) const {
+    std::int64_t half = divisor / 2;
+    return Money(cents >= 0 ? (cents + half) / divisor : (cents - half) / divisor);
+}
+
+std::string Money::toString() const {
+    // Work in unsigned space so the most negative value is formatted correctly
+    std::uint64_t magnitude = cents < 0
+        ? static_cast<std::uint64_t>(-(cents + 1)) + 1
+        : static_cast<std::uint64_t>(cents);
+
+    std::string digits = std::to_string(magnitude / 100);
+    std::uint64_t remainder = magnitude % 100;
+
+    std::string result;
+    result.reserve(digits.size() + 4);
+    if (cents < 0) {
+        result += '-';
+    }
+    result += digits;
+    result += '.';
+    result += static_cast<char>('0' + remainder / 10);
+    result += static_cast<char>('0' + remainder % 10);
+    return result;
+}
@@ -1,36 +1,35 @@
 ﻿#include "../../include/models/Transaction.h"
 
 Transaction::Transaction() :
-    amount(0.0),
-    date(std::time(nullptr)), // Current time
-    category(""),
-    type(TransactionType::EXPENSE),
-    cachedMonthKey("") {
+    amount(),
+    date(DateUtils::timeFromDayKey(DateUtils::currentDayKey())), // Today
+    categoryId(CategoryDictionary::instance().intern("")),
+    type(TransactionType::EXPENSE) {
+    updatePeriodKeys();
 }
 
-Transaction::Transaction(double amount, time_t date, const std::string& category, TransactionType type) :
+Transaction::Transaction(Money amount, time_t date, const std::string& category, TransactionType type) :
+    Transaction(amount, date, CategoryDictionary::instance().intern(category), type) {
+}
+
+Transaction::Transaction(Money amount, time_t date, CategoryId categoryId, TransactionType type) :
     amount(amount),
     date(date),
-    category(category),
-    type(type),
-    cachedMonthKey("") {
-    // Initialize the month key cache
-    updateMonthKeyCache();
+    categoryId(categoryId),
+    type(type) {
+    updatePeriodKeys();
 }
 
-void Transaction::updateMonthKeyCache() const {
-    std::tm* timeInfo = std::localtime(&date);
-
-    std::stringstream ss;
-    ss << std::put_time(timeInfo, "%Y-%m");
-    cachedMonthKey = ss.str();
+void Transaction::updatePeriodKeys() {
+    monthKey = DateUtils::monthKeyFromTime(date);
+    dayKey = DateUtils::dayKeyFromTime(date);
 }
 
-double Transaction::getAmount() const {
+Money Transaction::getAmount() const {
     return amount;
 }
 
-void Transaction::setAmount(double amount) {
+void Transaction::setAmount(Money amount) {
     this->amount = amount;
 }
 
@@ -40,16 +39,20 @@ time_t Transaction::getDate() const {
 
 void Transaction::setDate(time_t date) {
     this->date = date;
-    // Update month key cache when date changes
-    updateMonthKeyCache();
+    // Keep the period keys in step with the date
+    updatePeriodKeys();
 }
 
 std::string Transaction::getCategory() const {
-    return category;
+    return CategoryDictionary::instance().getName(categoryId);
 }
 
 void Transaction::setCategory(const std::string& category) {
-    this->category = category;
+    categoryId = CategoryDictionary::instance().intern(category);
+}
+
+CategoryId Transaction::getCategoryId() const {
+    return categoryId;
 }
 
 TransactionType Transaction::getType() const {
@@ -61,45 +64,49 @@ void Transaction::setType(TransactionType type) {
 }
 
 std::string Transaction::getFormattedDate() const {
-    std::tm* timeInfo = std::localtime(&date);
-
-    std::stringstream ss;
-    ss << std::put_time(timeInfo, "%Y-%m-%d");
-    return ss.str();
+    return DateUtils::formatDayKey(dayKey);
 }
 
 std::string Transaction::getFormattedAmount() const {
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(2) << amount;
+    return formatAmount(amount, type);
+}
 
+std::string Transaction::getTypeAsString() const {
+    return typeToString(type);
+}
+
+std::string Transaction::getDisplayString() const {
+    return formatDisplayString(getFormattedDate(), type, getCategory(), amount);
+}
+
+std::string Transaction::formatAmount(Money amount, TransactionType type) {
     if (type == TransactionType::INCOME) {
-        return "$" + ss.str();
+        return "$" + amount.toString();
     }
     else {
-        return "-$" + ss.str();
+        return "-$" + amount.toString();
     }
 }
 
-std::string Transaction::getTypeAsString() const {
+std::string Transaction::typeToString(TransactionType type) {
     return (type == TransactionType::INCOME) ? "Income" : "Expense";
 }
 
-std::string Transaction::getDisplayString() const {
+std::string Transaction::formatDisplayString(const std::string& formattedDate, TransactionType type,
+    const std::string& category, Money amount) {
     std::stringstream ss;
-    ss << "[" << getFormattedDate() << "] ";
-    ss << getTypeAsString() << ": ";
-    ss << getCategory() << " - ";
-    ss << getFormattedAmount();
+    ss << "[" << formattedDate << "] ";
+    ss << typeToString(type) << ": ";
+    ss << category << " - ";
+    ss << formatAmount(amount, type);
 
     return ss.str();
 }
 
-std::string Transaction::getMonthKey() const {
-    // Return the cached month key
-    // This avoids repeated calls to localtime() which can be expensive
-    if (cachedMonthKey.empty()) {
-        updateMonthKeyCache();
-    }
+MonthKey Transaction::getMonthKey() const {
+    return monthKey;
+}
 
-    return cachedMonthKey;
+DayKey Transaction::getDayKey() const {
+    return dayKey;
 }
\ No newline at end of file
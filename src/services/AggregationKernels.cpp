@@ -0,0 +1,355 @@
+#include "../../include/services/AggregationKernels.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+// Vector paths need GCC/Clang target attributes; other compilers use the scalar loops
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define AGGREGATION_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+    using Aggregate = AggregationKernels::Aggregate;
+    using TypeTotals = AggregationKernels::TypeTotals;
+    using Mask = AggregationKernels::Mask;
+
+    bool filtersAmount(const Mask& mask) {
+        return mask.minCents != std::numeric_limits<std::int64_t>::min() ||
+            mask.maxCents != std::numeric_limits<std::int64_t>::max();
+    }
+
+    // Scalar kernels; also used for the tails of the vector kernels
+
+    void aggregateScalar(const std::int64_t* amounts, const TransactionType* types,
+        const CategoryId* categories, size_t count, const Mask& mask, Aggregate& result) {
+        for (size_t i = 0; i < count; ++i) {
+            if ((mask.filterType && types[i] != mask.type) ||
+                (mask.filterCategory && categories[i] != mask.categoryId) ||
+                amounts[i] < mask.minCents || amounts[i] > mask.maxCents) {
+                continue;
+            }
+            result.sum += amounts[i];
+            result.count++;
+            result.min = std::min(result.min, amounts[i]);
+            result.max = std::max(result.max, amounts[i]);
+        }
+    }
+
+    void totalsByTypeScalar(const std::int64_t* amounts, const TransactionType* types, size_t count,
+        TypeTotals& result) {
+        for (size_t i = 0; i < count; ++i) {
+            if (types[i] == TransactionType::INCOME) {
+                result.incomeCents += amounts[i];
+                result.incomeCount++;
+            }
+            else {
+                result.expenseCents += amounts[i];
+                result.expenseCount++;
+            }
+            result.minCents = std::min(result.minCents, amounts[i]);
+            result.maxCents = std::max(result.maxCents, amounts[i]);
+        }
+    }
+
+    Aggregate aggregateScalarEntry(const std::int64_t* amounts, const TransactionType* types,
+        const CategoryId* categories, size_t count, const Mask& mask) {
+        Aggregate result;
+        aggregateScalar(amounts, types, categories, count, mask, result);
+        return result;
+    }
+
+    TypeTotals totalsByTypeScalarEntry(const std::int64_t* amounts, const TransactionType* types, size_t count) {
+        TypeTotals result;
+        totalsByTypeScalar(amounts, types, count, result);
+        return result;
+    }
+
+#ifdef AGGREGATION_KERNELS_X86
+
+    // AVX2: four rows per iteration
+
+    __attribute__((target("avx2")))
+    Aggregate aggregateAvx2(const std::int64_t* amounts, const TransactionType* types,
+        const CategoryId* categories, size_t count, const Mask& mask) {
+        const bool filterAmount = filtersAmount(mask);
+        const __m256i typeValue = _mm256_set1_epi64x(static_cast<long long>(mask.type));
+        const __m256i categoryValue = _mm256_set1_epi64x(static_cast<long long>(mask.categoryId));
+        const __m256i minValue = _mm256_set1_epi64x(mask.minCents);
+        const __m256i maxValue = _mm256_set1_epi64x(mask.maxCents);
+
+        __m256i sum = _mm256_setzero_si256();
+        __m256i selected = _mm256_setzero_si256();
+        __m256i low = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::max());
+        __m256i high = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m256i amount = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(amounts + i));
+            __m256i keep = _mm256_set1_epi64x(-1);
+
+            if (mask.filterType) {
+                std::int32_t packed;
+                std::memcpy(&packed, types + i, sizeof(packed));
+                __m256i type = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed));
+                keep = _mm256_and_si256(keep, _mm256_cmpeq_epi64(type, typeValue));
+            }
+            if (mask.filterCategory) {
+                __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(categories + i));
+                __m256i category = _mm256_cvtepu32_epi64(packed);
+                keep = _mm256_and_si256(keep, _mm256_cmpeq_epi64(category, categoryValue));
+            }
+            if (filterAmount) {
+                __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi64(minValue, amount),
+                    _mm256_cmpgt_epi64(amount, maxValue));
+                keep = _mm256_andnot_si256(outside, keep);
+            }
+
+            sum = _mm256_add_epi64(sum, _mm256_and_si256(amount, keep));
+            selected = _mm256_sub_epi64(selected, keep);    // keep lanes are -1
+            low = _mm256_blendv_epi8(low, amount, _mm256_and_si256(keep, _mm256_cmpgt_epi64(low, amount)));
+            high = _mm256_blendv_epi8(high, amount, _mm256_and_si256(keep, _mm256_cmpgt_epi64(amount, high)));
+        }
+
+        alignas(32) std::int64_t lanes[4][4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[0]), sum);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[1]), selected);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[2]), low);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[3]), high);
+
+        Aggregate result;
+        for (int lane = 0; lane < 4; ++lane) {
+            result.sum += lanes[0][lane];
+            result.count += static_cast<size_t>(lanes[1][lane]);
+            result.min = std::min(result.min, lanes[2][lane]);
+            result.max = std::max(result.max, lanes[3][lane]);
+        }
+
+        aggregateScalar(amounts + i, types + i, categories + i, count - i, mask, result);
+        return result;
+    }
+
+    __attribute__((target("avx2")))
+    TypeTotals totalsByTypeAvx2(const std::int64_t* amounts, const TransactionType* types, size_t count) {
+        const __m256i incomeValue = _mm256_set1_epi64x(static_cast<long long>(TransactionType::INCOME));
+
+        __m256i total = _mm256_setzero_si256();
+        __m256i income = _mm256_setzero_si256();
+        __m256i incomeRows = _mm256_setzero_si256();
+        __m256i low = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::max());
+        __m256i high = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m256i amount = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(amounts + i));
+            std::int32_t packed;
+            std::memcpy(&packed, types + i, sizeof(packed));
+            __m256i isIncome = _mm256_cmpeq_epi64(_mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed)), incomeValue);
+
+            total = _mm256_add_epi64(total, amount);
+            income = _mm256_add_epi64(income, _mm256_and_si256(amount, isIncome));
+            incomeRows = _mm256_sub_epi64(incomeRows, isIncome);
+            low = _mm256_blendv_epi8(low, amount, _mm256_cmpgt_epi64(low, amount));
+            high = _mm256_blendv_epi8(high, amount, _mm256_cmpgt_epi64(amount, high));
+        }
+
+        alignas(32) std::int64_t lanes[5][4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[0]), total);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[1]), income);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[2]), incomeRows);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[3]), low);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[4]), high);
+
+        TypeTotals result;
+        std::int64_t totalCents = 0;
+        for (int lane = 0; lane < 4; ++lane) {
+            totalCents += lanes[0][lane];
+            result.incomeCents += lanes[1][lane];
+            result.incomeCount += static_cast<size_t>(lanes[2][lane]);
+            result.minCents = std::min(result.minCents, lanes[3][lane]);
+            result.maxCents = std::max(result.maxCents, lanes[4][lane]);
+        }
+        result.expenseCents = totalCents - result.incomeCents;
+        result.expenseCount = i - result.incomeCount;
+
+        totalsByTypeScalar(amounts + i, types + i, count - i, result);
+        return result;
+    }
+
+    // SSE4.2: two rows per iteration (64-bit compares need SSE4.2)
+
+    __attribute__((target("sse4.2")))
+    Aggregate aggregateSse42(const std::int64_t* amounts, const TransactionType* types,
+        const CategoryId* categories, size_t count, const Mask& mask) {
+        const bool filterAmount = filtersAmount(mask);
+        const __m128i typeValue = _mm_set1_epi64x(static_cast<long long>(mask.type));
+        const __m128i categoryValue = _mm_set1_epi64x(static_cast<long long>(mask.categoryId));
+        const __m128i minValue = _mm_set1_epi64x(mask.minCents);
+        const __m128i maxValue = _mm_set1_epi64x(mask.maxCents);
+
+        __m128i sum = _mm_setzero_si128();
+        __m128i selected = _mm_setzero_si128();
+        __m128i low = _mm_set1_epi64x(std::numeric_limits<std::int64_t>::max());
+        __m128i high = _mm_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+
+        size_t i = 0;
+        for (; i + 2 <= count; i += 2) {
+            __m128i amount = _mm_loadu_si128(reinterpret_cast<const __m128i*>(amounts + i));
+            __m128i keep = _mm_set1_epi64x(-1);
+
+            if (mask.filterType) {
+                std::uint16_t packed;
+                std::memcpy(&packed, types + i, sizeof(packed));
+                __m128i type = _mm_cvtepu8_epi64(_mm_cvtsi32_si128(packed));
+                keep = _mm_and_si128(keep, _mm_cmpeq_epi64(type, typeValue));
+            }
+            if (mask.filterCategory) {
+                __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(categories + i));
+                keep = _mm_and_si128(keep, _mm_cmpeq_epi64(_mm_cvtepu32_epi64(packed), categoryValue));
+            }
+            if (filterAmount) {
+                __m128i outside = _mm_or_si128(_mm_cmpgt_epi64(minValue, amount), _mm_cmpgt_epi64(amount, maxValue));
+                keep = _mm_andnot_si128(outside, keep);
+            }
+
+            sum = _mm_add_epi64(sum, _mm_and_si128(amount, keep));
+            selected = _mm_sub_epi64(selected, keep);
+            low = _mm_blendv_epi8(low, amount, _mm_and_si128(keep, _mm_cmpgt_epi64(low, amount)));
+            high = _mm_blendv_epi8(high, amount, _mm_and_si128(keep, _mm_cmpgt_epi64(amount, high)));
+        }
+
+        alignas(16) std::int64_t lanes[4][2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[0]), sum);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[1]), selected);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[2]), low);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[3]), high);
+
+        Aggregate result;
+        for (int lane = 0; lane < 2; ++lane) {
+            result.sum += lanes[0][lane];
+            result.count += static_cast<size_t>(lanes[1][lane]);
+            result.min = std::min(result.min, lanes[2][lane]);
+            result.max = std::max(result.max, lanes[3][lane]);
+        }
+
+        aggregateScalar(amounts + i, types + i, categories + i, count - i, mask, result);
+        return result;
+    }
+
+    __attribute__((target("sse4.2")))
+    TypeTotals totalsByTypeSse42(const std::int64_t* amounts, const TransactionType* types, size_t count) {
+        const __m128i incomeValue = _mm_set1_epi64x(static_cast<long long>(TransactionType::INCOME));
+
+        __m128i total = _mm_setzero_si128();
+        __m128i income = _mm_setzero_si128();
+        __m128i incomeRows = _mm_setzero_si128();
+        __m128i low = _mm_set1_epi64x(std::numeric_limits<std::int64_t>::max());
+        __m128i high = _mm_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+
+        size_t i = 0;
+        for (; i + 2 <= count; i += 2) {
+            __m128i amount = _mm_loadu_si128(reinterpret_cast<const __m128i*>(amounts + i));
+            std::uint16_t packed;
+            std::memcpy(&packed, types + i, sizeof(packed));
+            __m128i isIncome = _mm_cmpeq_epi64(_mm_cvtepu8_epi64(_mm_cvtsi32_si128(packed)), incomeValue);
+
+            total = _mm_add_epi64(total, amount);
+            income = _mm_add_epi64(income, _mm_and_si128(amount, isIncome));
+            incomeRows = _mm_sub_epi64(incomeRows, isIncome);
+            low = _mm_blendv_epi8(low, amount, _mm_cmpgt_epi64(low, amount));
+            high = _mm_blendv_epi8(high, amount, _mm_cmpgt_epi64(amount, high));
+        }
+
+        alignas(16) std::int64_t lanes[5][2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[0]), total);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[1]), income);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[2]), incomeRows);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[3]), low);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[4]), high);
+
+        TypeTotals result;
+        std::int64_t totalCents = 0;
+        for (int lane = 0; lane < 2; ++lane) {
+            totalCents += lanes[0][lane];
+            result.incomeCents += lanes[1][lane];
+            result.incomeCount += static_cast<size_t>(lanes[2][lane]);
+            result.minCents = std::min(result.minCents, lanes[3][lane]);
+            result.maxCents = std::max(result.maxCents, lanes[4][lane]);
+        }
+        result.expenseCents = totalCents - result.incomeCents;
+        result.expenseCount = i - result.incomeCount;
+
+        totalsByTypeScalar(amounts + i, types + i, count - i, result);
+        return result;
+    }
+
+#endif // AGGREGATION_KERNELS_X86
+
+    struct KernelTable {
+        Aggregate (*aggregate)(const std::int64_t*, const TransactionType*, const CategoryId*, size_t, const Mask&);
+        TypeTotals (*totalsByType)(const std::int64_t*, const TransactionType*, size_t);
+        const char* name;
+    };
+
+    const KernelTable scalarKernels = { aggregateScalarEntry, totalsByTypeScalarEntry, "scalar" };
+#ifdef AGGREGATION_KERNELS_X86
+    const KernelTable avx2Kernels = { aggregateAvx2, totalsByTypeAvx2, "avx2" };
+    const KernelTable sse42Kernels = { aggregateSse42, totalsByTypeSse42, "sse4.2" };
+#endif
+
+    // Looks up a variant by name; null if unknown or the CPU lacks it
+    const KernelTable* findKernels(const std::string& name) {
+#ifdef AGGREGATION_KERNELS_X86
+        __builtin_cpu_init();
+        if (name == avx2Kernels.name) {
+            return __builtin_cpu_supports("avx2") ? &avx2Kernels : nullptr;
+        }
+        if (name == sse42Kernels.name) {
+            return __builtin_cpu_supports("sse4.2") ? &sse42Kernels : nullptr;
+        }
+#endif
+        return (name == scalarKernels.name) ? &scalarKernels : nullptr;
+    }
+
+    const KernelTable* selectKernels() {
+#ifdef AGGREGATION_KERNELS_X86
+        if (const KernelTable* table = findKernels(avx2Kernels.name)) {
+            return table;
+        }
+        if (const KernelTable* table = findKernels(sse42Kernels.name)) {
+            return table;
+        }
+#endif
+        return &scalarKernels;
+    }
+
+    // Chosen once, on first use; forceInstructionSet may swap it later
+    std::atomic<const KernelTable*>& kernels() {
+        static std::atomic<const KernelTable*> table{ selectKernels() };
+        return table;
+    }
+}
+
+AggregationKernels::Aggregate AggregationKernels::aggregate(const std::int64_t* amounts, const TransactionType* types,
+    const CategoryId* categories, size_t count, const Mask& mask) {
+    return kernels().load(std::memory_order_relaxed)->aggregate(amounts, types, categories, count, mask);
+}
+
+AggregationKernels::TypeTotals AggregationKernels::totalsByType(const std::int64_t* amounts,
+    const TransactionType* types, size_t count) {
+    return kernels().load(std::memory_order_relaxed)->totalsByType(amounts, types, count);
+}
+
+const char* AggregationKernels::activeInstructionSet() {
+    return kernels().load(std::memory_order_relaxed)->name;
+}
+
+bool AggregationKernels::forceInstructionSet(const std::string& name) {
+    const KernelTable* table = name.empty() ? selectKernels() : findKernels(name);
+    if (!table) {
+        return false;
+    }
+
+    kernels().store(table, std::memory_order_relaxed);
+    return true;
+}
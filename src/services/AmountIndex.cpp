@@ -0,0 +1,84 @@
+#include "../../include/services/AmountIndex.h"
+#include <algorithm>
+#include <numeric>
+#include <iterator>
+
+void AmountIndex::clear() {
+    rowsByAmount.clear();
+    appendedRows.clear();
+    mergedRows.clear();
+}
+
+void AmountIndex::rebuild(const TransactionStore& store) {
+    rowsByAmount.clear();
+    onAppend(store, 0);
+}
+
+void AmountIndex::onAppend(const TransactionStore& store, size_t firstRow) {
+    const auto& amounts = store.amountCents();
+    auto byAmount = [&amounts](TransactionStore::RowIndex a, TransactionStore::RowIndex b) {
+        return amounts[a] < amounts[b];
+    };
+
+    // Single additions: a new row goes after equal amounts, as the merge would put it
+    if (!rowsByAmount.empty() && store.size() - firstRow <= MAX_INPLACE_APPEND) {
+        for (size_t row = firstRow; row < store.size(); ++row) {
+            auto position = std::upper_bound(rowsByAmount.begin(), rowsByAmount.end(),
+                static_cast<TransactionStore::RowIndex>(row), byAmount);
+            rowsByAmount.insert(position, static_cast<TransactionStore::RowIndex>(row));
+        }
+        return;
+    }
+
+    appendedRows.resize(store.size() - firstRow);
+    std::iota(appendedRows.begin(), appendedRows.end(), static_cast<TransactionStore::RowIndex>(firstRow));
+    std::stable_sort(appendedRows.begin(), appendedRows.end(), byAmount);
+
+    if (rowsByAmount.empty()) {
+        rowsByAmount.swap(appendedRows);
+        return;
+    }
+
+    mergedRows.clear();
+    mergedRows.reserve(rowsByAmount.size() + appendedRows.size());
+    std::merge(rowsByAmount.begin(), rowsByAmount.end(), appendedRows.begin(), appendedRows.end(),
+        std::back_inserter(mergedRows), byAmount);
+    rowsByAmount.swap(mergedRows);
+}
+
+void AmountIndex::onInsert(const TransactionStore& store, size_t row) {
+    const auto inserted = static_cast<TransactionStore::RowIndex>(row);
+
+    // Shift every later row
+    for (auto& existing : rowsByAmount) {
+        if (existing >= inserted) {
+            ++existing;
+        }
+    }
+
+    const auto& amounts = store.amountCents();
+    auto position = std::upper_bound(rowsByAmount.begin(), rowsByAmount.end(), amounts[row],
+        [&amounts](std::int64_t amount, TransactionStore::RowIndex other) {
+            return amount < amounts[other];
+        });
+    rowsByAmount.insert(position, inserted);
+}
+
+std::pair<size_t, size_t> AmountIndex::findRange(const TransactionStore& store,
+    std::int64_t minCents, std::int64_t maxCents) const {
+    if (minCents > maxCents) {
+        return { 0, 0 };
+    }
+
+    const auto& amounts = store.amountCents();
+    auto begin = std::lower_bound(rowsByAmount.begin(), rowsByAmount.end(), minCents,
+        [&amounts](TransactionStore::RowIndex row, std::int64_t amount) {
+            return amounts[row] < amount;
+        });
+    auto end = std::upper_bound(begin, rowsByAmount.end(), maxCents,
+        [&amounts](std::int64_t amount, TransactionStore::RowIndex row) {
+            return amount < amounts[row];
+        });
+
+    return { static_cast<size_t>(begin - rowsByAmount.begin()), static_cast<size_t>(end - rowsByAmount.begin()) };
+}
@@ -30,7 +30,7 @@ BudgetManager::~BudgetManager() {
 }
 
 void BudgetManager::addBudget(const std::shared_ptr<Budget>& budget) {
-    std::string key = createBudgetKey(budget->getCategory(), budget->getYearMonth());
+    std::uint64_t key = createBudgetKey(budget->getCategoryId(), budget->getMonthKey());
     bool changed = false;
 
     // Check if budget already exists
@@ -55,8 +55,8 @@ void BudgetManager::addBudget(const std::shared_ptr<Budget>& budget) {
     }
 }
 
-void BudgetManager::updateBudget(const std::string& category, const std::string& yearMonth, double newLimit) {
-    std::string key = createBudgetKey(category, yearMonth);
+void BudgetManager::updateBudget(const std::string& category, MonthKey monthKey, Money newLimit) {
+    std::uint64_t key = createBudgetKey(CategoryDictionary::instance().intern(category), monthKey);
     bool changed = false;
 
     // Try to find and update existing budget - O(1) lookup
@@ -70,7 +70,7 @@ void BudgetManager::updateBudget(const std::string& category, const std::string&
     }
     else {
         // If budget doesn't exist, create a new one
-        auto newBudget = std::make_shared<Budget>(category, yearMonth, newLimit);
+        auto newBudget = std::make_shared<Budget>(category, monthKey, newLimit);
         budgets[key] = newBudget;
         changed = true;
     }
@@ -81,8 +81,12 @@ void BudgetManager::updateBudget(const std::string& category, const std::string&
     }
 }
 
-bool BudgetManager::removeBudget(const std::string& category, const std::string& yearMonth) {
-    std::string key = createBudgetKey(category, yearMonth);
+bool BudgetManager::removeBudget(const std::string& category, MonthKey monthKey) {
+    CategoryId categoryId;
+    if (!CategoryDictionary::instance().find(category, categoryId)) {
+        return false;
+    }
+    std::uint64_t key = createBudgetKey(categoryId, monthKey);
 
     // Look up the budget - O(1) operation
     auto it = budgets.find(key);
@@ -108,11 +112,20 @@ std::vector<std::shared_ptr<Budget>> BudgetManager::getAllBudgets() const {
 }
 
 std::vector<std::shared_ptr<Budget>> BudgetManager::getBudgetsByCategory(const std::string& category) const {
+    CategoryId categoryId;
+    if (!CategoryDictionary::instance().find(category, categoryId)) {
+        return {};
+    }
+
+    return getBudgetsByCategory(categoryId);
+}
+
+std::vector<std::shared_ptr<Budget>> BudgetManager::getBudgetsByCategory(CategoryId categoryId) const {
     std::vector<std::shared_ptr<Budget>> result;
 
     // Still need to scan, but only scanning the values is more cache-friendly
     for (const auto& pair : budgets) {
-        if (pair.second->getCategory() == category) {
+        if (pair.second->getCategoryId() == categoryId) {
             result.push_back(pair.second);
         }
     }
@@ -120,12 +133,12 @@ std::vector<std::shared_ptr<Budget>> BudgetManager::getBudgetsByCategory(const s
     return result;
 }
 
-std::vector<std::shared_ptr<Budget>> BudgetManager::getBudgetsByYearMonth(const std::string& yearMonth) const {
+std::vector<std::shared_ptr<Budget>> BudgetManager::getBudgetsByYearMonth(MonthKey monthKey) const {
     std::vector<std::shared_ptr<Budget>> result;
 
     // Still need to scan, but only scanning the values is more cache-friendly
     for (const auto& pair : budgets) {
-        if (pair.second->getYearMonth() == yearMonth) {
+        if (pair.second->getMonthKey() == monthKey) {
             result.push_back(pair.second);
         }
     }
@@ -133,16 +146,29 @@ std::vector<std::shared_ptr<Budget>> BudgetManager::getBudgetsByYearMonth(const
     return result;
 }
 
-std::shared_ptr<Budget> BudgetManager::getBudget(const std::string& category, const std::string& yearMonth) const {
-    std::string key = createBudgetKey(category, yearMonth);
+std::shared_ptr<Budget> BudgetManager::getBudget(const std::string& category, MonthKey monthKey) const {
+    CategoryId categoryId;
+    if (!CategoryDictionary::instance().find(category, categoryId)) {
+        return nullptr;
+    }
+
+    return getBudget(categoryId, monthKey);
+}
+
+std::shared_ptr<Budget> BudgetManager::getBudget(CategoryId categoryId, MonthKey monthKey) const {
+    std::uint64_t key = createBudgetKey(categoryId, monthKey);
 
     // Direct lookup - O(1) operation
     auto it = budgets.find(key);
     return (it != budgets.end()) ? it->second : nullptr;
 }
 
-bool BudgetManager::hasBudget(const std::string& category, const std::string& yearMonth) const {
-    std::string key = createBudgetKey(category, yearMonth);
+bool BudgetManager::hasBudget(const std::string& category, MonthKey monthKey) const {
+    CategoryId categoryId;
+    if (!CategoryDictionary::instance().find(category, categoryId)) {
+        return false;
+    }
+    std::uint64_t key = createBudgetKey(categoryId, monthKey);
 
     // Direct lookup without creating a temporary shared_ptr - O(1) operation
     return budgets.find(key) != budgets.end();
@@ -172,7 +198,7 @@ void BudgetManager::saveBudgets() {
     for (const auto& [key, budget] : budgets) {
         file << budget->getCategory() << ","
             << budget->getYearMonth() << ","
-            << budget->getLimitAmount() << "\n";
+            << budget->getLimitAmount().toString() << "\n";
     }
 
     file.close();
@@ -211,11 +237,16 @@ void BudgetManager::loadBudgets() {
             std::getline(ss, limitStr)) {
 
             try {
-                double limitAmount = std::stod(limitStr);
-                auto budget = std::make_shared<Budget>(category, yearMonth, limitAmount);
+                MonthKey monthKey;
+                if (!DateUtils::parseYearMonth(yearMonth, monthKey)) {
+                    throw std::invalid_argument("Invalid year-month");
+                }
+
+                Money limitAmount = Money::fromString(limitStr);
+                auto budget = std::make_shared<Budget>(category, monthKey, limitAmount);
 
                 // Use the map with our composite key for O(1) insertion
-                std::string key = createBudgetKey(category, yearMonth);
+                std::uint64_t key = createBudgetKey(budget->getCategoryId(), monthKey);
                 budgets[key] = budget;
             }
             catch (const std::exception& e) {
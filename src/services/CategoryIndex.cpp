@@ -0,0 +1,39 @@
+#include "../../include/services/CategoryIndex.h"
+#include <algorithm>
+
+void CategoryIndex::clear() {
+    postings.clear();
+}
+
+void CategoryIndex::rebuild(const TransactionStore& store) {
+    postings.clear();
+    onAppend(store, 0);
+}
+
+void CategoryIndex::onAppend(const TransactionStore& store, size_t firstRow) {
+    const auto& categories = store.categoryIds();
+
+    for (size_t row = firstRow; row < store.size(); ++row) {
+        postings[categories[row]].push_back(static_cast<TransactionStore::RowIndex>(row));
+    }
+}
+
+void CategoryIndex::onInsert(const TransactionStore& store, size_t row) {
+    const auto inserted = static_cast<TransactionStore::RowIndex>(row);
+
+    // Shift every later row; lists are sorted so only their tails change
+    for (auto& [categoryId, rows] : postings) {
+        auto tail = std::lower_bound(rows.begin(), rows.end(), inserted);
+        for (; tail != rows.end(); ++tail) {
+            ++(*tail);
+        }
+    }
+
+    auto& rows = postings[store.categoryIds()[row]];
+    rows.insert(std::lower_bound(rows.begin(), rows.end(), inserted), inserted);
+}
+
+const std::vector<TransactionStore::RowIndex>* CategoryIndex::find(CategoryId categoryId) const {
+    auto it = postings.find(categoryId);
+    return (it != postings.end()) ? &it->second : nullptr;
+}
@@ -6,8 +6,7 @@ CategoryManager::CategoryManager() {
 }
 
 void CategoryManager::initializeDefaultCategories() {
-    // Initialize default income categories
-    defaultCategories[TransactionType::INCOME] = {
+    const std::vector<std::string> incomeCategories = {
         "Salary",
         "Freelance",
         "Investments",
@@ -16,8 +15,7 @@ void CategoryManager::initializeDefaultCategories() {
         "Other Income"
     };
 
-    // Initialize default expense categories
-    defaultCategories[TransactionType::EXPENSE] = {
+    const std::vector<std::string> expenseCategories = {
         "Food & Dining",
         "Housing",
         "Transportation",
@@ -34,46 +32,46 @@ void CategoryManager::initializeDefaultCategories() {
         "Other Expenses"
     };
 
+    // Intern default categories into the shared dictionary
+    auto& dictionary = CategoryDictionary::instance();
+    for (const auto& category : incomeCategories) {
+        defaultCategories[TransactionType::INCOME].insert(dictionary.intern(category));
+    }
+    for (const auto& category : expenseCategories) {
+        defaultCategories[TransactionType::EXPENSE].insert(dictionary.intern(category));
+    }
+
     // Initialize empty custom categories maps
     customCategories[TransactionType::INCOME] = {};
     customCategories[TransactionType::EXPENSE] = {};
 }
 
-std::vector<std::string> CategoryManager::getAllCategories(TransactionType type) const {
+std::vector<std::string> CategoryManager::toSortedNames(const std::set<CategoryId>& ids) const {
+    const auto& dictionary = CategoryDictionary::instance();
     std::vector<std::string> result;
+    result.reserve(ids.size());
 
-    // Add default categories
-    for (const auto& category : defaultCategories.at(type)) {
-        result.push_back(category);
-    }
-
-    // Add custom categories
-    for (const auto& category : customCategories.at(type)) {
-        result.push_back(category);
+    for (CategoryId id : ids) {
+        result.push_back(dictionary.getName(id));
     }
 
     // Sort alphabetically for better user experience
     std::sort(result.begin(), result.end());
-
     return result;
 }
 
+std::vector<std::string> CategoryManager::getAllCategories(TransactionType type) const {
+    std::set<CategoryId> ids = defaultCategories.at(type);
+    ids.insert(customCategories.at(type).begin(), customCategories.at(type).end());
+    return toSortedNames(ids);
+}
+
 std::vector<std::string> CategoryManager::getDefaultCategories(TransactionType type) const {
-    std::vector<std::string> result;
-    for (const auto& category : defaultCategories.at(type)) {
-        result.push_back(category);
-    }
-    std::sort(result.begin(), result.end());
-    return result;
+    return toSortedNames(defaultCategories.at(type));
 }
 
 std::vector<std::string> CategoryManager::getCustomCategories(TransactionType type) const {
-    std::vector<std::string> result;
-    for (const auto& category : customCategories.at(type)) {
-        result.push_back(category);
-    }
-    std::sort(result.begin(), result.end());
-    return result;
+    return toSortedNames(customCategories.at(type));
 }
 
 bool CategoryManager::addCategory(const std::string& category, TransactionType type) {
@@ -83,7 +81,7 @@ bool CategoryManager::addCategory(const std::string& category, TransactionType t
     }
 
     // Add to custom categories
-    customCategories[type].insert(category);
+    customCategories[type].insert(CategoryDictionary::instance().intern(category));
     return true;
 }
 
@@ -94,23 +92,46 @@ bool CategoryManager::removeCategory(const std::string& category, TransactionTyp
     }
 
     // Check if the custom category exists
-    if (customCategories[type].find(category) == customCategories[type].end()) {
+    CategoryId id;
+    if (!CategoryDictionary::instance().find(category, id) ||
+        customCategories[type].find(id) == customCategories[type].end()) {
         return false;
     }
 
     // Remove the category
-    customCategories[type].erase(category);
+    customCategories[type].erase(id);
     return true;
 }
 
+bool CategoryManager::renameCategory(const std::string& category, const std::string& newName, TransactionType type) {
+    // Default categories keep their names
+    if (isDefaultCategory(category, type)) {
+        return false;
+    }
+
+    CategoryId id;
+    if (!CategoryDictionary::instance().find(category, id) ||
+        customCategories[type].find(id) == customCategories[type].end()) {
+        return false;
+    }
+
+    // A single dictionary update renames it everywhere
+    return CategoryDictionary::instance().rename(id, newName);
+}
+
 bool CategoryManager::categoryExists(const std::string& category, TransactionType type) const {
+    CategoryId id;
+    if (!CategoryDictionary::instance().find(category, id)) {
+        return false;
+    }
+
     // Check in default categories
-    if (defaultCategories.at(type).find(category) != defaultCategories.at(type).end()) {
+    if (defaultCategories.at(type).find(id) != defaultCategories.at(type).end()) {
         return true;
     }
 
     // Check in custom categories
-    if (customCategories.at(type).find(category) != customCategories.at(type).end()) {
+    if (customCategories.at(type).find(id) != customCategories.at(type).end()) {
         return true;
     }
 
@@ -118,5 +139,7 @@ bool CategoryManager::categoryExists(const std::string& category, TransactionTyp
 }
 
 bool CategoryManager::isDefaultCategory(const std::string& category, TransactionType type) const {
-    return defaultCategories.at(type).find(category) != defaultCategories.at(type).end();
-}
\ No newline at end of file
+    CategoryId id;
+    return CategoryDictionary::instance().find(category, id) &&
+        defaultCategories.at(type).find(id) != defaultCategories.at(type).end();
+}
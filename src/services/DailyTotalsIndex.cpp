@@ -0,0 +1,126 @@
+#include "../../include/services/DailyTotalsIndex.h"
+#include <algorithm>
+
+void DailyTotalsIndex::clear() {
+    days.clear();
+    dailyIncome.clear();
+    dailyExpenses.clear();
+    incomeTree.clear();
+    expenseTree.clear();
+}
+
+void DailyTotalsIndex::rebuild(const TransactionStore& store) {
+    clear();
+    if (store.empty()) {
+        return;
+    }
+
+    // Rows are date-sorted, so each day is one run and the days come out in order
+    const auto& dayKeys = store.dayKeys();
+    const auto& amounts = store.amountCents();
+    const auto& types = store.types();
+    for (size_t row = 0; row < store.size(); ++row) {
+        if (days.empty() || days.back() != dayKeys[row]) {
+            days.push_back(dayKeys[row]);
+            dailyIncome.push_back(0);
+            dailyExpenses.push_back(0);
+        }
+        auto& totals = (types[row] == TransactionType::INCOME) ? dailyIncome : dailyExpenses;
+        totals.back() += amounts[row];
+    }
+
+    rebuildTrees();
+}
+
+void DailyTotalsIndex::onAppend(const TransactionStore& store, size_t firstRow) {
+    const auto& dayKeys = store.dayKeys();
+    const auto& amounts = store.amountCents();
+    const auto& types = store.types();
+
+    for (size_t row = firstRow; row < store.size(); ++row) {
+        add(dayKeys[row], types[row], amounts[row]);
+    }
+}
+
+void DailyTotalsIndex::add(DayKey day, TransactionType type, std::int64_t cents) {
+    size_t slot = slotFor(day);
+    auto& totals = (type == TransactionType::INCOME) ? dailyIncome : dailyExpenses;
+    auto& tree = (type == TransactionType::INCOME) ? incomeTree : expenseTree;
+
+    totals[slot] += cents;
+    for (size_t node = slot + 1; node < tree.size(); node += node & (~node + 1)) {
+        tree[node] += cents;
+    }
+}
+
+std::int64_t DailyTotalsIndex::sumRange(DayKey firstDay, DayKey lastDay, TransactionType type) const {
+    if (days.empty() || firstDay > lastDay) {
+        return 0;
+    }
+
+    // Slots [first, end) hold the days inside the range
+    size_t first = static_cast<size_t>(std::lower_bound(days.begin(), days.end(), firstDay) - days.begin());
+    size_t end = static_cast<size_t>(std::upper_bound(days.begin(), days.end(), lastDay) - days.begin());
+    if (first >= end) {
+        return 0;
+    }
+
+    const auto& tree = (type == TransactionType::INCOME) ? incomeTree : expenseTree;
+    return prefixSum(tree, end) - prefixSum(tree, first);
+}
+
+size_t DailyTotalsIndex::slotFor(DayKey day) {
+    auto position = std::lower_bound(days.begin(), days.end(), day);
+    size_t slot = static_cast<size_t>(position - days.begin());
+    if (position != days.end() && *position == day) {
+        return slot;
+    }
+
+    if (position == days.end()) {
+        // A new newest day: extend the trees by one node. The node covers
+        // slots (slot + 1 - lowbit, slot + 1], all but itself already summed.
+        days.push_back(day);
+        dailyIncome.push_back(0);
+        dailyExpenses.push_back(0);
+
+        size_t node = slot + 1;
+        size_t covered = node - (node & (~node + 1));
+        incomeTree.resize(node + 1);
+        expenseTree.resize(node + 1);
+        incomeTree[node] = prefixSum(incomeTree, slot) - prefixSum(incomeTree, covered);
+        expenseTree[node] = prefixSum(expenseTree, slot) - prefixSum(expenseTree, covered);
+        return slot;
+    }
+
+    // An earlier day shifts every later slot; rebuild the trees around it
+    days.insert(position, day);
+    dailyIncome.insert(dailyIncome.begin() + static_cast<std::ptrdiff_t>(slot), 0);
+    dailyExpenses.insert(dailyExpenses.begin() + static_cast<std::ptrdiff_t>(slot), 0);
+    rebuildTrees();
+    return slot;
+}
+
+void DailyTotalsIndex::rebuildTrees() {
+    // Linear-time Fenwick construction: push each node into its parent once
+    auto build = [](const std::vector<std::int64_t>& values, std::vector<std::int64_t>& tree) {
+        tree.assign(values.size() + 1, 0);
+        std::copy(values.begin(), values.end(), tree.begin() + 1);
+        for (size_t node = 1; node < tree.size(); ++node) {
+            size_t parent = node + (node & (~node + 1));
+            if (parent < tree.size()) {
+                tree[parent] += tree[node];
+            }
+        }
+    };
+
+    build(dailyIncome, incomeTree);
+    build(dailyExpenses, expenseTree);
+}
+
+std::int64_t DailyTotalsIndex::prefixSum(const std::vector<std::int64_t>& tree, size_t slotCount) {
+    std::int64_t total = 0;
+    for (size_t node = slotCount; node > 0; node &= node - 1) {
+        total += tree[node];
+    }
+    return total;
+}
@@ -0,0 +1,12 @@
+#include "../../include/services/ParallelAggregator.h"
+
+ParallelAggregator::ParallelAggregator(size_t threadCount) {
+    setThreadCount(threadCount);
+}
+
+void ParallelAggregator::setThreadCount(size_t count) {
+    if (count == 0) {
+        count = std::thread::hardware_concurrency();
+    }
+    threadCount = (count > 0) ? count : 1;
+}
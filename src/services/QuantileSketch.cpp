@@ -0,0 +1,131 @@
+#include "../../include/services/QuantileSketch.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+QuantileSketch::QuantileSketch(size_t k)
+    : k(std::max<size_t>(k, 8)), count(0),
+    minValue(std::numeric_limits<std::int64_t>::max()), maxValue(std::numeric_limits<std::int64_t>::min()) {
+}
+
+size_t QuantileSketch::capacity(size_t level) const {
+    // Lower levels shrink geometrically below the top level's k
+    size_t depth = levels.size() - 1 - level;
+    double scaled = std::ceil(static_cast<double>(k) * std::pow(2.0 / 3.0, static_cast<double>(depth)));
+    return std::max<size_t>(2, static_cast<size_t>(scaled));
+}
+
+void QuantileSketch::add(std::int64_t value) {
+    if (levels.empty()) {
+        levels.emplace_back();
+        keepOdd.push_back(false);
+    }
+
+    levels[0].push_back(value);
+    count++;
+    minValue = std::min(minValue, value);
+    maxValue = std::max(maxValue, value);
+
+    if (levels[0].size() >= capacity(0)) {
+        compress();
+    }
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.empty()) {
+        return;
+    }
+
+    while (levels.size() < other.levels.size()) {
+        levels.emplace_back();
+        keepOdd.push_back(false);
+    }
+    for (size_t level = 0; level < other.levels.size(); ++level) {
+        levels[level].insert(levels[level].end(), other.levels[level].begin(), other.levels[level].end());
+    }
+
+    count += other.count;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+
+    compress();
+}
+
+void QuantileSketch::compress() {
+    for (size_t level = 0; level < levels.size(); ++level) {
+        if (levels[level].size() < capacity(level)) {
+            continue;
+        }
+
+        if (level + 1 == levels.size()) {
+            levels.emplace_back();
+            keepOdd.push_back(false);
+        }
+
+        auto& items = levels[level];
+        std::sort(items.begin(), items.end());
+
+        // An odd item out stays behind so total weight is preserved exactly
+        std::int64_t leftover = 0;
+        bool hasLeftover = (items.size() % 2) != 0;
+        if (hasLeftover) {
+            leftover = items.back();
+            items.pop_back();
+        }
+
+        size_t offset = keepOdd[level] ? 1 : 0;
+        keepOdd[level] = !keepOdd[level];
+
+        auto& promoted = levels[level + 1];
+        for (size_t index = offset; index < items.size(); index += 2) {
+            promoted.push_back(items[index]);
+        }
+
+        items.clear();
+        if (hasLeftover) {
+            items.push_back(leftover);
+        }
+    }
+}
+
+std::int64_t QuantileSketch::quantile(double fraction) const {
+    if (empty()) {
+        return 0;
+    }
+    if (fraction <= 0.0) {
+        return minValue;
+    }
+    if (fraction >= 1.0) {
+        return maxValue;
+    }
+
+    // Every retained item carries the weight of its level
+    std::vector<std::pair<std::int64_t, std::uint64_t>> weighted;
+    weighted.reserve(retained());
+    for (size_t level = 0; level < levels.size(); ++level) {
+        for (std::int64_t value : levels[level]) {
+            weighted.emplace_back(value, std::uint64_t(1) << level);
+        }
+    }
+    std::sort(weighted.begin(), weighted.end());
+
+    double target = std::ceil(fraction * static_cast<double>(count));
+    std::uint64_t cumulative = 0;
+    for (const auto& [value, weight] : weighted) {
+        cumulative += weight;
+        if (static_cast<double>(cumulative) >= target) {
+            return value;
+        }
+    }
+
+    return maxValue;
+}
+
+size_t QuantileSketch::retained() const {
+    size_t total = 0;
+    for (const auto& items : levels) {
+        total += items.size();
+    }
+    return total;
+}
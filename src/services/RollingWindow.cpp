@@ -0,0 +1,138 @@
+#include "../../include/services/RollingWindow.h"
+#include <algorithm>
+
+RollingWindow::RollingWindow(size_t windowDays)
+    : windowDays(std::max<size_t>(windowDays, 1)), filterCategory(false), categoryId(0) {
+}
+
+RollingWindow::RollingWindow(size_t windowDays, CategoryId categoryId)
+    : windowDays(std::max<size_t>(windowDays, 1)), filterCategory(true), categoryId(categoryId) {
+}
+
+void RollingWindow::reset() {
+    head = 0;
+    tail = 0;
+    windowCents = 0;
+    started = false;
+    nextDay = 0;
+    series.clear();
+}
+
+void RollingWindow::update(const TransactionStore& store, const CategoryIndex& categoryIndex) {
+    if (store.empty()) {
+        return;
+    }
+
+    // The source is either every row or one category's posting list
+    const std::vector<TransactionStore::RowIndex>* postings = nullptr;
+    size_t sourceSize = store.size();
+    if (filterCategory) {
+        postings = categoryIndex.find(categoryId);
+        sourceSize = postings ? postings->size() : 0;
+    }
+    if (sourceSize == 0) {
+        return;
+    }
+
+    const auto& dayKeys = store.dayKeys();
+    const auto& amounts = store.amountCents();
+    const auto& types = store.types();
+    auto rowAt = [postings](size_t position) -> size_t {
+        return postings ? (*postings)[position] : position;
+    };
+    auto expenseAt = [&](size_t row) -> std::int64_t {
+        return (types[row] == TransactionType::EXPENSE) ? amounts[row] : 0;
+    };
+
+    if (!started) {
+        nextDay = dayKeys[rowAt(0)];
+        started = true;
+    }
+    else if (head < sourceSize && dayKeys[rowAt(head)] < nextDay) {
+        // New rows landed on the last swept day; sweep it again
+        nextDay = dayKeys[rowAt(head)];
+        if (!series.empty() && series.back().day >= nextDay) {
+            series.pop_back();
+        }
+    }
+
+    const DayKey lastDay = dayKeys.back();
+    const DayKey span = static_cast<DayKey>(windowDays);
+
+    while (true) {
+        // The next change: a row arrives at the head or the oldest one leaves at the tail
+        bool changes = false;
+        DayKey day = 0;
+        if (head < sourceSize) {
+            day = dayKeys[rowAt(head)];
+            changes = true;
+        }
+        if (tail < head) {
+            DayKey leaves = dayKeys[rowAt(tail)] + span;
+            day = changes ? std::min(day, leaves) : leaves;
+            changes = true;
+        }
+        if (!changes || day > lastDay) {
+            break;
+        }
+        day = std::max(day, nextDay);
+
+        while (head < sourceSize && dayKeys[rowAt(head)] <= day) {
+            windowCents += expenseAt(rowAt(head));
+            ++head;
+        }
+        while (tail < head && dayKeys[rowAt(tail)] <= day - span) {
+            windowCents -= expenseAt(rowAt(tail));
+            ++tail;
+        }
+
+        // The day's own rows sit just behind the head (including any swept
+        // before this day was last emitted)
+        std::int64_t dayCents = 0;
+        for (size_t position = head; position > 0 && dayKeys[rowAt(position - 1)] == day; --position) {
+            dayCents += expenseAt(rowAt(position - 1));
+        }
+
+        RollingPoint point;
+        point.day = day;
+        point.dayTotal = Money::fromCents(dayCents);
+        point.windowSum = Money::fromCents(windowCents);
+        point.dailyAverage = point.windowSum.dividedBy(static_cast<std::int64_t>(windowDays));
+        series.push_back(point);
+
+        nextDay = day + 1;
+    }
+
+    nextDay = std::max(nextDay, lastDay + 1);
+}
+
+RollingPoint RollingWindow::pointAt(DayKey day) const {
+    RollingPoint point;
+    point.day = day;
+    if (series.empty() || day < series.front().day) {
+        return point;
+    }
+
+    // The last change on or before the day
+    auto after = std::upper_bound(series.begin(), series.end(), day,
+        [](DayKey value, const RollingPoint& candidate) { return value < candidate.day; });
+    const RollingPoint& last = *(after - 1);
+    if (last.day == day) {
+        return last;
+    }
+
+    // A quiet day: nothing was added since the last change, so only drop the
+    // days that slid out after it (none, inside the swept range)
+    const DayKey span = static_cast<DayKey>(windowDays);
+    std::int64_t cents = last.windowSum.getCents();
+    DayKey dropTo = std::min(day - span, last.day);
+    auto dropped = std::lower_bound(series.begin(), after, last.day - span + 1,
+        [](const RollingPoint& candidate, DayKey value) { return candidate.day < value; });
+    for (; dropped != after && dropped->day <= dropTo; ++dropped) {
+        cents -= dropped->dayTotal.getCents();
+    }
+
+    point.windowSum = Money::fromCents(cents);
+    point.dailyAverage = point.windowSum.dividedBy(static_cast<std::int64_t>(windowDays));
+    return point;
+}
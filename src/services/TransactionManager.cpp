@@ -1,12 +1,97 @@
 #include "../../include/services/TransactionManager.h"
 #include "../../include/utils/FileUtils.h"
 #include "../../include/utils/DateUtils.h"
+#include "../../include/services/AggregationKernels.h"
 #include <algorithm>
-#include <numeric>
 #include <iostream>
 #include "../../include/services/BudgetManager.h"
 #include "../../include/models/Budget.h"  // For Budget class definition
 
+namespace {
+    // Partial result of totalling a chunk of rows
+    struct LedgerTotals {
+        std::map<MonthKey, MonthlyTotals> months;
+        FinancialSummary summary;
+        std::unordered_map<std::uint64_t, Money> categoryMonthSpend;
+        std::unordered_map<std::uint64_t, QuantileSketch> expenseSketches;
+    };
+
+    void accumulateChunk(const TransactionStore& store, size_t firstRow, size_t endRow, LedgerTotals& totals) {
+        const auto& monthKeys = store.monthKeys();
+        const std::int64_t* amounts = store.amountCents().data();
+        const TransactionType* types = store.types().data();
+        const CategoryId* categories = store.categoryIds().data();
+        FinancialSummary& summary = totals.summary;
+
+        // Rows are date-sorted, so each month is a contiguous run
+        size_t row = firstRow;
+        while (row < endRow) {
+            const MonthKey month = monthKeys[row];
+            size_t runEnd = std::upper_bound(monthKeys.begin() + row, monthKeys.begin() + endRow, month) - monthKeys.begin();
+
+            auto run = AggregationKernels::totalsByType(amounts + row, types + row, runEnd - row);
+
+            auto& monthTotals = totals.months[month];
+            monthTotals.income += Money::fromCents(run.incomeCents);
+            monthTotals.expenses += Money::fromCents(run.expenseCents);
+
+            Money runMin = Money::fromCents(run.minCents);
+            Money runMax = Money::fromCents(run.maxCents);
+            if (summary.transactionCount == 0 || runMin < summary.minAmount) {
+                summary.minAmount = runMin;
+            }
+            if (summary.transactionCount == 0 || runMax > summary.maxAmount) {
+                summary.maxAmount = runMax;
+            }
+
+            summary.totalIncome += Money::fromCents(run.incomeCents);
+            summary.totalExpenses += Money::fromCents(run.expenseCents);
+            summary.transactionCount += runEnd - row;
+            summary.incomeCount += run.incomeCount;
+            summary.expenseCount += run.expenseCount;
+
+            for (; row < runEnd; ++row) {
+                if (types[row] == TransactionType::EXPENSE) {
+                    std::uint64_t key = BudgetManager::createBudgetKey(categories[row], month);
+                    totals.categoryMonthSpend[key] += Money::fromCents(amounts[row]);
+                    totals.expenseSketches[key].add(amounts[row]);
+                }
+            }
+        }
+    }
+
+    void mergeTotals(LedgerTotals& into, const LedgerTotals& next) {
+        for (const auto& [month, totals] : next.months) {
+            auto& target = into.months[month];
+            target.income += totals.income;
+            target.expenses += totals.expenses;
+        }
+
+        for (const auto& [key, spend] : next.categoryMonthSpend) {
+            into.categoryMonthSpend[key] += spend;
+        }
+        for (const auto& [key, sketch] : next.expenseSketches) {
+            into.expenseSketches[key].merge(sketch);
+        }
+
+        FinancialSummary& summary = into.summary;
+        if (next.summary.transactionCount > 0) {
+            if (summary.transactionCount == 0 || next.summary.minAmount < summary.minAmount) {
+                summary.minAmount = next.summary.minAmount;
+            }
+            if (summary.transactionCount == 0 || next.summary.maxAmount > summary.maxAmount) {
+                summary.maxAmount = next.summary.maxAmount;
+            }
+        }
+
+        summary.totalIncome += next.summary.totalIncome;
+        summary.totalExpenses += next.summary.totalExpenses;
+        summary.transactionCount += next.summary.transactionCount;
+        summary.incomeCount += next.summary.incomeCount;
+        summary.expenseCount += next.summary.expenseCount;
+    }
+}
+
 TransactionManager::TransactionManager() {
     loadTransactions();
 }
@@ -34,103 +119,206 @@ TransactionManager::~TransactionManager() {
 }
 
 void TransactionManager::addTransaction(const std::shared_ptr<Transaction>& transaction) {
-    transactions.push_back(transaction);
-    // Sort transactions by date (newest first)
-    std::sort(transactions.begin(), transactions.end(),
-        [](const std::shared_ptr<Transaction>& a, const std::shared_ptr<Transaction>& b) {
-            return a->getDate() > b->getDate();
-        });
+    // Ordered insert keeps the ledger sorted by date
+    size_t row = store.insert(*transaction);
+    onRowInserted(row);
 }
 
-std::vector<std::shared_ptr<Transaction>> TransactionManager::getAllTransactions() const {
-    return transactions;
+void TransactionManager::addTransactions(const std::vector<std::shared_ptr<Transaction>>& batch) {
+    size_t firstRow = store.size();
+
+    // Sorts the batch once and merges it into the ledger
+    if (store.insertBatch(batch)) {
+        onRowsAppended(firstRow);
+    }
+    else {
+        rebuildDerivedState();
+    }
 }
 
-std::vector<std::shared_ptr<Transaction>> TransactionManager::getTransactionsByCategory(const std::string& category) const {
-    std::vector<std::shared_ptr<Transaction>> result;
+void TransactionManager::onRowInserted(size_t row) {
+    if (row + 1 == store.size()) {
+        onRowsAppended(row);
+        return;
+    }
 
-    for (const auto& t : transactions) {
-        if (t->getCategory() == category) {
-            result.push_back(t);
-        }
+    categoryIndex.onInsert(store, row);
+    amountIndex.onInsert(store, row);
+    dailyTotals.add(store.dayKeys()[row], store.types()[row], store.amountCents()[row]);
+    accumulateRows(row, row + 1);
+
+    // Rows shifted under the sweeps; they restart on next read
+    std::lock_guard<std::mutex> lock(rollingWindowsMutex);
+    for (auto& [key, window] : rollingWindows) {
+        window.reset();
     }
+}
 
-    return result;
+void TransactionManager::onRowsAppended(size_t firstRow) {
+    categoryIndex.onAppend(store, firstRow);
+    amountIndex.onAppend(store, firstRow);
+    dailyTotals.onAppend(store, firstRow);
+    accumulateRows(firstRow, store.size());
 }
 
-std::vector<std::shared_ptr<Transaction>> TransactionManager::getTransactionsByType(TransactionType type) const {
-    std::vector<std::shared_ptr<Transaction>> result;
+void TransactionManager::rebuildDerivedState() {
+    categoryIndex.rebuild(store);
+    amountIndex.rebuild(store);
+    dailyTotals.rebuild(store);
 
-    for (const auto& t : transactions) {
-        if (t->getType() == type) {
-            result.push_back(t);
-        }
+    monthlyTotals.clear();
+    categoryMonthSpend.clear();
+    expenseSketches.clear();
+    runningSummary = FinancialSummary();
+    accumulateRows(0, store.size());
+
+    std::lock_guard<std::mutex> lock(rollingWindowsMutex);
+    for (auto& [key, window] : rollingWindows) {
+        window.reset();
     }
+}
+
+void TransactionManager::accumulateRows(size_t firstRow, size_t endRow) {
+    // Each worker totals its own chunk; partials merge in chunk order
+    LedgerTotals totals = aggregator.reduce<LedgerTotals>(firstRow, endRow,
+        [this](size_t first, size_t end) {
+            LedgerTotals partial;
+            accumulateChunk(store, first, end, partial);
+            return partial;
+        },
+        [](LedgerTotals& into, LedgerTotals&& next) {
+            mergeTotals(into, next);
+        });
 
-    return result;
+    LedgerTotals current{ std::move(monthlyTotals), runningSummary, std::move(categoryMonthSpend),
+        std::move(expenseSketches) };
+    mergeTotals(current, totals);
+    monthlyTotals = std::move(current.months);
+    runningSummary = current.summary;
+    categoryMonthSpend = std::move(current.categoryMonthSpend);
+    expenseSketches = std::move(current.expenseSketches);
 }
 
-std::vector<std::shared_ptr<Transaction>> TransactionManager::getTransactionsByDateRange(time_t startDate, time_t endDate) const {
-    std::vector<std::shared_ptr<Transaction>> result;
+TransactionView TransactionManager::viewAll() const {
+    return TransactionView(store, size_t(0), store.size());
+}
 
-    for (const auto& t : transactions) {
-        if (DateUtils::isDateInRange(t->getDate(), startDate, endDate)) {
-            result.push_back(t);
-        }
+TransactionView TransactionManager::viewByCategory(const std::string& category) const {
+    CategoryId categoryId;
+    if (!CategoryDictionary::instance().find(category, categoryId)) {
+        return TransactionView();
     }
 
-    return result;
+    return viewByCategory(categoryId);
 }
 
-std::vector<std::shared_ptr<Transaction>> TransactionManager::getTransactionsByAmountRange(double minAmount, double maxAmount) const {
-    std::vector<std::shared_ptr<Transaction>> filteredTransactions;
-    for (const auto& transaction : transactions) {
-        double amount = transaction->getAmount();
-        if (amount >= minAmount && amount <= maxAmount) {
-            filteredTransactions.push_back(transaction);
-        }
+TransactionView TransactionManager::viewByCategory(CategoryId categoryId) const {
+    // The posting list is already in date order
+    const auto* rows = categoryIndex.find(categoryId);
+    if (!rows) {
+        return TransactionView();
     }
-    return filteredTransactions;
+
+    return TransactionView(store, rows->data(), rows->size());
 }
 
-std::map<std::string, std::vector<std::shared_ptr<Transaction>>> TransactionManager::getTransactionsByMonth() const {
-    std::map<std::string, std::vector<std::shared_ptr<Transaction>>> monthlyTransactions;
+TransactionView TransactionManager::viewByType(TransactionType type) const {
+    const auto& types = store.types();
+    std::vector<TransactionStore::RowIndex> rows;
 
-    for (const auto& t : transactions) {
-        std::string monthKey = t->getMonthKey();
-        monthlyTransactions[monthKey].push_back(t);
+    for (size_t row = 0; row < store.size(); ++row) {
+        if (types[row] == type) {
+            rows.push_back(static_cast<TransactionStore::RowIndex>(row));
+        }
     }
 
-    return monthlyTransactions;
+    return TransactionView(store, std::move(rows));
+}
+
+TransactionView TransactionManager::viewByDateRange(time_t startDate, time_t endDate) const {
+    // Whole days, inclusive on both ends (same as DateUtils::isDateInRange)
+    auto [first, last] = store.findDayRange(DateUtils::dayKeyFromTime(startDate), DateUtils::dayKeyFromTime(endDate));
+    return TransactionView(store, first, last);
 }
 
-std::map<std::string, std::tuple<double, double, double>> TransactionManager::calculateMonthlySummary() const {
-    auto monthlyTransactions = getTransactionsByMonth();
-    std::map<std::string, std::tuple<double, double, double>> monthlySummary;
+TransactionView TransactionManager::viewByAmountRange(Money minAmount, Money maxAmount) const {
+    auto [first, last] = amountIndex.findRange(store, minAmount.getCents(), maxAmount.getCents());
+    const auto& rowsByAmount = amountIndex.rows();
 
-    for (const auto& [month, transactions] : monthlyTransactions) {
-        double income = 0.0;
-        double expenses = 0.0;
+    // Back to date order so the view reads newest first, like the other filters
+    std::vector<TransactionStore::RowIndex> rows(rowsByAmount.begin() + first, rowsByAmount.begin() + last);
+    std::sort(rows.begin(), rows.end());
 
-        for (const auto& t : transactions) {
-            if (t->getType() == TransactionType::INCOME) {
-                income += t->getAmount();
-            }
-            else {
-                expenses += t->getAmount();
-            }
-        }
+    return TransactionView(store, std::move(rows));
+}
+
+TransactionView TransactionManager::viewByMonth(MonthKey month) const {
+    auto [first, last] = store.findMonthRange(month);
+    return TransactionView(store, first, last);
+}
+
+TransactionQuery TransactionManager::query() const {
+    return TransactionQuery(store, categoryIndex, amountIndex, aggregator);
+}
 
-        double netAmount = income - expenses;
-        monthlySummary[month] = std::make_tuple(income, expenses, netAmount);
+std::vector<std::shared_ptr<Transaction>> TransactionManager::getAllTransactions() const {
+    return viewAll().materialize();
+}
+
+std::vector<std::shared_ptr<Transaction>> TransactionManager::getTransactionsByCategory(const std::string& category) const {
+    return viewByCategory(category).materialize();
+}
+
+std::vector<std::shared_ptr<Transaction>> TransactionManager::getTransactionsByType(TransactionType type) const {
+    return viewByType(type).materialize();
+}
+
+std::vector<std::shared_ptr<Transaction>> TransactionManager::getTransactionsByDateRange(time_t startDate, time_t endDate) const {
+    return viewByDateRange(startDate, endDate).materialize();
+}
+
+std::vector<std::shared_ptr<Transaction>> TransactionManager::getTransactionsByAmountRange(Money minAmount, Money maxAmount) const {
+    return viewByAmountRange(minAmount, maxAmount).materialize();
+}
+
+TransactionView TransactionManager::topK(size_t k, const TransactionQuery& filter) const {
+    return filter.topK(k);
+}
+
+std::vector<std::shared_ptr<Transaction>> TransactionManager::getLargestTransactions(size_t count, Money minAmount, Money maxAmount) const {
+    return query().amountBetween(minAmount, maxAmount).topK(count).materialize();
+}
+
+std::map<MonthKey, std::vector<std::shared_ptr<Transaction>>> TransactionManager::getTransactionsByMonth() const {
+    std::map<MonthKey, std::vector<std::shared_ptr<Transaction>>> monthlyTransactions;
+
+    // Each month is a contiguous run of rows
+    for (const auto& [month, totals] : monthlyTotals) {
+        monthlyTransactions.emplace_hint(monthlyTransactions.end(), month, viewByMonth(month).materialize());
+    }
+
+    return monthlyTransactions;
+}
+
+std::map<MonthKey, std::tuple<Money, Money, Money>> TransactionManager::calculateMonthlySummary() const {
+    std::map<MonthKey, std::tuple<Money, Money, Money>> monthlySummary;
+
+    // Read straight from the maintained per-month totals
+    for (const auto& [month, totals] : monthlyTotals) {
+        monthlySummary.emplace_hint(monthlySummary.end(), month,
+            std::make_tuple(totals.income, totals.expenses, totals.getNetAmount()));
     }
 
     return monthlySummary;
 }
 
+const std::map<MonthKey, MonthlyTotals>& TransactionManager::getMonthlyTotals() const {
+    return monthlyTotals;
+}
+
 void TransactionManager::saveTransactions() {
     try {
-        int savedCount = FileUtils::saveTransactionsToCSV(transactions, dataFilePath);
+        int savedCount = FileUtils::saveTransactionsToCSV(viewAll(), dataFilePath);
         std::cout << "Saved " << savedCount << " transactions to " << dataFilePath << std::endl;
     }
     catch (const std::exception& e) {
@@ -151,9 +339,11 @@ void TransactionManager::loadTransactions() {
             return;
         }
 
-        // Load transactions from file
-        auto loadResult = FileUtils::loadTransactionsFromCSV(dataFilePath);
-        transactions = loadResult.transactions;
+        // Parse the file across the aggregation workers, then sort the batch once
+        auto loadResult = FileUtils::loadTransactionsFromCSV(dataFilePath, aggregator);
+        store.clear();
+        store.insertBatch(loadResult.transactions);
+        rebuildDerivedState();
 
         // Log any errors that occurred during loading
         if (loadResult.hasErrors()) {
@@ -165,22 +355,102 @@ void TransactionManager::loadTransactions() {
     }
 }
 
-double TransactionManager::getTotalIncome() const {
-    return std::accumulate(transactions.begin(), transactions.end(), 0.0,
-        [](double sum, const std::shared_ptr<Transaction>& t) {
-            return sum + (t->getType() == TransactionType::INCOME ? t->getAmount() : 0.0);
-        });
+Money TransactionManager::sumRange(time_t startDate, time_t endDate, TransactionType type) const {
+    // Whole days, inclusive on both ends (same as getTransactionsByDateRange)
+    return Money::fromCents(dailyTotals.sumRange(DateUtils::dayKeyFromTime(startDate),
+        DateUtils::dayKeyFromTime(endDate), type));
 }
 
-double TransactionManager::getTotalExpenses() const {
-    return std::accumulate(transactions.begin(), transactions.end(), 0.0,
-        [](double sum, const std::shared_ptr<Transaction>& t) {
-            return sum + (t->getType() == TransactionType::EXPENSE ? t->getAmount() : 0.0);
-        });
+Money TransactionManager::getCategoryMonthSpend(CategoryId categoryId, MonthKey monthKey) const {
+    auto it = categoryMonthSpend.find(BudgetManager::createBudgetKey(categoryId, monthKey));
+    return (it != categoryMonthSpend.end()) ? it->second : Money();
 }
 
-double TransactionManager::getNetAmount() const {
-    return getTotalIncome() - getTotalExpenses();
+QuantileSketch TransactionManager::getExpenseSketch(CategoryId categoryId, MonthKey monthKey) const {
+    auto it = expenseSketches.find(BudgetManager::createBudgetKey(categoryId, monthKey));
+    return (it != expenseSketches.end()) ? it->second : QuantileSketch();
+}
+
+std::map<CategoryId, QuantileSketch> TransactionManager::getCategoryExpenseSketches() const {
+    // Merge each category's monthly sketches
+    std::map<CategoryId, QuantileSketch> sketches;
+    for (const auto& [key, sketch] : expenseSketches) {
+        sketches[static_cast<CategoryId>(key >> 32)].merge(sketch);
+    }
+    return sketches;
+}
+
+std::map<CategoryId, QuantileSketch> TransactionManager::getCategoryExpenseSketches(MonthKey monthKey) const {
+    std::map<CategoryId, QuantileSketch> sketches;
+    for (const auto& [key, sketch] : expenseSketches) {
+        if (static_cast<MonthKey>(static_cast<std::uint32_t>(key)) == monthKey) {
+            sketches[static_cast<CategoryId>(key >> 32)].merge(sketch);
+        }
+    }
+    return sketches;
+}
+
+std::map<MonthKey, QuantileSketch> TransactionManager::getMonthlyExpenseSketches() const {
+    // Merge every category's sketch for each month
+    std::map<MonthKey, QuantileSketch> sketches;
+    for (const auto& [key, sketch] : expenseSketches) {
+        sketches[static_cast<MonthKey>(static_cast<std::uint32_t>(key))].merge(sketch);
+    }
+    return sketches;
+}
+
+RollingWindow TransactionManager::getRollingSpend(size_t windowDays) const {
+    std::lock_guard<std::mutex> lock(rollingWindowsMutex);
+    return sweptWindow(windowDays, false, CategoryId(0));
+}
+
+RollingWindow TransactionManager::getRollingSpend(size_t windowDays, CategoryId categoryId) const {
+    std::lock_guard<std::mutex> lock(rollingWindowsMutex);
+    return sweptWindow(windowDays, true, categoryId);
+}
+
+RollingWindow& TransactionManager::sweptWindow(size_t windowDays, bool filterCategory, CategoryId categoryId) const {
+    auto key = std::make_tuple(windowDays, filterCategory, categoryId);
+    auto it = rollingWindows.find(key);
+    if (it == rollingWindows.end()) {
+        it = rollingWindows.emplace(key, filterCategory ? RollingWindow(windowDays, categoryId) : RollingWindow(windowDays)).first;
+    }
+
+    // Appended rows extend the sweep where it stopped
+    it->second.update(store, categoryIndex);
+    return it->second;
+}
+
+void TransactionManager::setAggregationThreads(size_t threadCount) {
+    aggregator.setThreadCount(threadCount);
+}
+
+size_t TransactionManager::getAggregationThreads() const {
+    return aggregator.getThreadCount();
+}
+
+Money TransactionManager::getTotalIncome() const {
+    return runningSummary.totalIncome;
+}
+
+Money TransactionManager::getTotalExpenses() const {
+    return runningSummary.totalExpenses;
+}
+
+Money TransactionManager::getNetAmount() const {
+    return runningSummary.totalIncome - runningSummary.totalExpenses;
+}
+
+FinancialSummary TransactionManager::getFinancialSummary() const {
+    FinancialSummary summary = runningSummary;
+    summary.netAmount = summary.totalIncome - summary.totalExpenses;
+
+    if (summary.transactionCount > 0) {
+        summary.meanAmount = (summary.totalIncome + summary.totalExpenses)
+            .dividedBy(static_cast<std::int64_t>(summary.transactionCount));
+    }
+
+    return summary;
 }
 
 bool TransactionManager::checkBudgetExceeded(const std::shared_ptr<Transaction>& transaction, const std::shared_ptr<BudgetManager>& budgetManager, std::string& warningMessage) const {
@@ -189,62 +459,80 @@ bool TransactionManager::checkBudgetExceeded(const std::shared_ptr<Transaction>&
         return false;
     }
 
+    CategoryId categoryId = transaction->getCategoryId();
     std::string category = transaction->getCategory();
-    std::string monthKey = transaction->getMonthKey();
-    double amount = transaction->getAmount();
-
-    // Get the budget for this category and month
-    // Using the correct method based on our BudgetManager implementation
-    auto budgets = budgetManager->getBudgetsByCategory(category);
-
-    // Find the budget for this specific month
-    std::shared_ptr<Budget> budget = nullptr;
-    for (const auto& b : budgets) {
-        // Extract year and month from the monthKey (assuming format "YYYY-MM")
-        std::string yearForComparison = monthKey.substr(0, 4);  // First 4 characters
-        std::string monthForComparison = monthKey.substr(5, 2); // Characters 5-6
-
-        if (b->getYearMonth().substr(0, 4) == yearForComparison && b->getYearMonth().substr(0, 4) == monthForComparison) {
-            budget = b;
-            break;
-        }
-    }
+    MonthKey monthKey = transaction->getMonthKey();
+    Money amount = transaction->getAmount();
 
+    // Direct (category, month) lookups; no ledger scan
+    std::shared_ptr<Budget> budget = budgetManager->getBudget(categoryId, monthKey);
     if (!budget) {
         return false; // No budget set for this category/month
     }
 
-    // Calculate current spending for this category in this month
-    double currentSpending = 0.0;
-    for (const auto& t : transactions) {
-        if (t->getType() == TransactionType::EXPENSE &&
-            t->getCategory() == category &&
-            t->getMonthKey() == monthKey) {
-            currentSpending += t->getAmount();
-        }
-    }
-
-    // Add the new transaction amount
-    double newTotal = currentSpending + amount;
+    // Add the new transaction amount to what is already spent this month
+    Money newTotal = getCategoryMonthSpend(categoryId, monthKey) + amount;
     // Use the correct method to get the budget amount (adjust if necessary)
-    double limit = budget->getLimitAmount();
+    Money limit = budget->getLimitAmount();
 
     // Check if it exceeds the budget
     if (newTotal > limit) {
-        double percentExceeded = ((newTotal - limit) / limit) * 100.0;
+        double percentExceeded = limit > Money()
+            ? (static_cast<double>((newTotal - limit).getCents()) / limit.getCents()) * 100.0
+            : 100.0;
         warningMessage = "WARNING: This expense will exceed your budget for " +
-            category + " in " + monthKey + " by $" +
-            std::to_string(newTotal - limit) +
+            category + " in " + DateUtils::formatMonthKey(monthKey) + " by $" +
+            (newTotal - limit).toString() +
             " (" + std::to_string(static_cast<int>(percentExceeded)) + "%).";
         return true;
     }
 
     // Check if it's close to the budget (90% or more)
-    if (newTotal >= 0.9 * limit) {
-        double percentUsed = (newTotal / limit) * 100.0;
+    if (limit > Money() && newTotal.getCents() * 10 >= limit.getCents() * 9) {
+        double percentUsed = (static_cast<double>(newTotal.getCents()) / limit.getCents()) * 100.0;
         warningMessage = "CAUTION: This expense will bring you to " +
             std::to_string(static_cast<int>(percentUsed)) +
-            "% of your budget for " + category + " in " + monthKey + ".";
+            "% of your budget for " + category + " in " + DateUtils::formatMonthKey(monthKey) + ".";
+        return true;
+    }
+
+    return false;
+}
+
+bool TransactionManager::checkSpendingSpike(const std::shared_ptr<Transaction>& transaction, std::string& warningMessage) const {
+    const size_t recentDays = 7;
+    const size_t baselineDays = 90;
+
+    if (transaction->getType() != TransactionType::EXPENSE) {
+        return false;
+    }
+
+    CategoryId categoryId = transaction->getCategoryId();
+    DayKey day = transaction->getDayKey();
+
+    // Read the cached windows in place rather than copying them on every expense
+    std::lock_guard<std::mutex> lock(rollingWindowsMutex);
+
+    // The baseline needs a full window of history before the recent one
+    const RollingWindow& baseline = sweptWindow(baselineDays, true, categoryId);
+    DayKey baselineEnd = day - static_cast<DayKey>(recentDays);
+    if (baseline.empty() || baseline.firstDay() > baselineEnd - static_cast<DayKey>(baselineDays) + 1) {
+        return false;
+    }
+
+    // Weekly rate over the 90 days before the recent week
+    std::int64_t baselineCents = baseline.pointAt(baselineEnd).windowSum.getCents();
+    Money usualWeek = Money::fromCents(baselineCents * static_cast<std::int64_t>(recentDays))
+        .dividedBy(static_cast<std::int64_t>(baselineDays));
+    if (usualWeek <= Money()) {
+        return false;
+    }
+
+    Money recentWeek = sweptWindow(recentDays, true, categoryId).pointAt(day).windowSum + transaction->getAmount();
+    if (recentWeek.getCents() > usualWeek.getCents() * 2) {
+        warningMessage = "NOTICE: This expense brings " + transaction->getCategory() +
+            " spending over the last 7 days to $" + recentWeek.toString() +
+            ", more than twice the usual $" + usualWeek.toString() + " per week.";
         return true;
     }
 
@@ -253,7 +541,7 @@ bool TransactionManager::checkBudgetExceeded(const std::shared_ptr<Transaction>&
 
 void TransactionManager::setUserProfile(std::shared_ptr<UserProfile> profile) {
     // Save current transactions if needed
-    if (!transactions.empty() && userProfile) {
+    if (!store.empty() && userProfile) {
         saveTransactions();
     }
 
@@ -0,0 +1,475 @@
+#include "../../include/services/TransactionQuery.h"
+#include "../../include/utils/DateUtils.h"
+#include "../../include/services/AggregationKernels.h"
+#include <algorithm>
+#include <sstream>
+#include <bit>
+#include <cmath>
+#include <tuple>
+
+namespace {
+    // Relative cost of checking a row reached through an index (random column
+    // reads) versus one reached by walking the date slice (sequential reads)
+    const double RANDOM_ROW_COST = 4.0;
+
+    const char* accessPathName(AccessPath path) {
+        switch (path) {
+        case AccessPath::EMPTY: return "empty (no row can match)";
+        case AccessPath::DATE_SLICE: return "date slice scan";
+        case AccessPath::CATEGORY_POSTINGS: return "category posting list";
+        case AccessPath::AMOUNT_RANGE: return "amount index range";
+        case AccessPath::CATEGORY_AMOUNT: return "category postings intersected with amount range";
+        }
+        return "unknown";
+    }
+}
+
+TransactionQuery::TransactionQuery(const TransactionStore& store, const CategoryIndex& categoryIndex, const AmountIndex& amountIndex,
+    const ParallelAggregator& aggregator)
+    : store(&store), categoryIndex(&categoryIndex), amountIndex(&amountIndex), aggregator(&aggregator), filterType(false), type(TransactionType::EXPENSE),
+    filterCategory(false), categoryId(0), matchesNothing(false),
+    firstDay(std::numeric_limits<DayKey>::min()), lastDay(std::numeric_limits<DayKey>::max()),
+    minCents(std::numeric_limits<std::int64_t>::min()), maxCents(std::numeric_limits<std::int64_t>::max()),
+    skipCount(0), maxCount(std::numeric_limits<size_t>::max()) {
+}
+
+TransactionQuery& TransactionQuery::ofType(TransactionType type) {
+    if (filterType && this->type != type) {
+        matchesNothing = true;
+    }
+    filterType = true;
+    this->type = type;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::inCategory(const std::string& category) {
+    CategoryId id;
+    if (!CategoryDictionary::instance().find(category, id)) {
+        matchesNothing = true;
+        return *this;
+    }
+    return inCategory(id);
+}
+
+TransactionQuery& TransactionQuery::inCategory(CategoryId categoryId) {
+    if (filterCategory && this->categoryId != categoryId) {
+        matchesNothing = true;
+    }
+    filterCategory = true;
+    this->categoryId = categoryId;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::betweenDates(time_t startDate, time_t endDate) {
+    firstDay = std::max(firstDay, DateUtils::dayKeyFromTime(startDate));
+    lastDay = std::min(lastDay, DateUtils::dayKeyFromTime(endDate));
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::inMonth(MonthKey month) {
+    // A month is the day range from its first day to the day before the next month
+    MonthKey next = month + 1;
+    firstDay = std::max(firstDay, DateUtils::daysFromCivil(DateUtils::monthKeyYear(month), DateUtils::monthKeyMonth(month), 1));
+    lastDay = std::min(lastDay, DateUtils::daysFromCivil(DateUtils::monthKeyYear(next), DateUtils::monthKeyMonth(next), 1) - 1);
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::amountBetween(Money minAmount, Money maxAmount) {
+    minCents = std::max(minCents, minAmount.getCents());
+    maxCents = std::min(maxCents, maxAmount.getCents());
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::offset(size_t count) {
+    skipCount = count;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::limit(size_t count) {
+    maxCount = count;
+    return *this;
+}
+
+std::pair<const TransactionStore::RowIndex*, const TransactionStore::RowIndex*>
+TransactionQuery::categoryRange(size_t firstRow, size_t lastRow) const {
+    const auto* postings = categoryIndex->find(categoryId);
+    if (!postings || postings->empty()) {
+        return { nullptr, nullptr };
+    }
+
+    const auto* begin = postings->data();
+    const auto* end = begin + postings->size();
+    return { std::lower_bound(begin, end, static_cast<TransactionStore::RowIndex>(firstRow)),
+        std::lower_bound(begin, end, static_cast<TransactionStore::RowIndex>(lastRow)) };
+}
+
+std::vector<std::uint64_t> TransactionQuery::amountBitmap(size_t firstRow, size_t lastRow) const {
+    auto [begin, end] = amountIndex->findRange(*store, minCents, maxCents);
+    const auto& rowsByAmount = amountIndex->rows();
+
+    // One bit per row of the date slice; clipping is a plain row-number compare
+    std::vector<std::uint64_t> bits((lastRow - firstRow + 63) / 64, 0);
+    for (size_t position = begin; position < end; ++position) {
+        size_t row = rowsByAmount[position];
+        if (row >= firstRow && row < lastRow) {
+            bits[(row - firstRow) / 64] |= std::uint64_t(1) << ((row - firstRow) % 64);
+        }
+    }
+
+    return bits;
+}
+
+bool TransactionQuery::matches(size_t row) const {
+    // Every access path is already clipped to the date slice
+    const std::int64_t amount = store->amountCents()[row];
+    return (!filterType || store->types()[row] == type) &&
+        (!filterCategory || store->categoryIds()[row] == categoryId) &&
+        amount >= minCents && amount <= maxCents;
+}
+
+QueryPlan TransactionQuery::plan() const {
+    QueryPlan result;
+    if (matchesNothing || maxCount == 0 || minCents > maxCents || firstDay > lastDay) {
+        return result;
+    }
+
+    std::tie(result.firstRow, result.lastRow) = store->findDayRange(firstDay, lastDay);
+    result.dateRows = result.lastRow - result.firstRow;
+    if (result.dateRows == 0) {
+        return result;
+    }
+
+    const bool filterAmount = minCents != std::numeric_limits<std::int64_t>::min() ||
+        maxCents != std::numeric_limits<std::int64_t>::max();
+    const double totalRows = static_cast<double>(store->size());
+    const double dateRows = static_cast<double>(result.dateRows);
+
+    // Fraction of the date slice each indexed predicate keeps
+    double selectivity = 1.0;
+    double amountInSlice = dateRows;
+
+    if (filterCategory) {
+        auto [begin, end] = categoryRange(result.firstRow, result.lastRow);
+        result.categoryRows = static_cast<size_t>(end - begin);
+        selectivity *= result.categoryRows / dateRows;
+    }
+    if (filterAmount) {
+        auto [begin, end] = amountIndex->findRange(*store, minCents, maxCents);
+        result.amountRows = end - begin;
+        // Assume the amount range is spread evenly over time
+        amountInSlice = result.amountRows * (dateRows / totalRows);
+        selectivity *= amountInSlice / dateRows;
+    }
+    if (filterType) {
+        // No statistics for type; assume an even income/expense split
+        selectivity *= 0.5;
+    }
+
+    const double expectedRows = dateRows * selectivity;
+    result.estimatedRows = static_cast<size_t>(expectedRows + 0.5);
+
+    // Ordered paths stop once the offset/limit window is filled
+    double window = static_cast<double>(skipCount) + static_cast<double>(maxCount);
+    double stopFraction = (expectedRows > window) ? window / expectedRows : 1.0;
+
+    result.path = AccessPath::DATE_SLICE;
+    result.estimatedCost = dateRows * stopFraction;
+
+    if (filterCategory) {
+        double cost = result.categoryRows * RANDOM_ROW_COST * stopFraction;
+        if (cost < result.estimatedCost) {
+            result.path = AccessPath::CATEGORY_POSTINGS;
+            result.estimatedCost = cost;
+        }
+    }
+    // Marking the amount range in a slice bitmap yields rows in date order without a sort
+    const double bitmapCost = result.amountRows + dateRows / 64.0;
+
+    if (filterAmount) {
+        double cost = bitmapCost + amountInSlice * RANDOM_ROW_COST * stopFraction;
+        if (cost < result.estimatedCost) {
+            result.path = AccessPath::AMOUNT_RANGE;
+            result.estimatedCost = cost;
+        }
+    }
+    if (filterCategory && filterAmount) {
+        double intersection = result.categoryRows * (amountInSlice / dateRows);
+        double cost = bitmapCost + (result.categoryRows + intersection * RANDOM_ROW_COST) * stopFraction;
+        if (cost < result.estimatedCost) {
+            result.path = AccessPath::CATEGORY_AMOUNT;
+            result.estimatedCost = cost;
+        }
+    }
+
+    return result;
+}
+
+std::string TransactionQuery::explain() const {
+    QueryPlan chosen = plan();
+    std::ostringstream out;
+
+    out << "Plan: " << accessPathName(chosen.path) << "\n";
+    if (chosen.path == AccessPath::EMPTY) {
+        return out.str();
+    }
+
+    out << "  date slice:        rows [" << chosen.firstRow << ", " << chosen.lastRow << ") = "
+        << chosen.dateRows << " candidates\n";
+    if (filterCategory) {
+        out << "  category postings: " << chosen.categoryRows << " candidates in slice ("
+            << CategoryDictionary::instance().getName(categoryId) << ")\n";
+    }
+    if (minCents != std::numeric_limits<std::int64_t>::min() || maxCents != std::numeric_limits<std::int64_t>::max()) {
+        out << "  amount index:      " << chosen.amountRows << " candidates in ledger\n";
+    }
+    if (filterType) {
+        out << "  type filter:       " << Transaction::typeToString(type) << " (checked per row)\n";
+    }
+    if (skipCount > 0 || maxCount != std::numeric_limits<size_t>::max()) {
+        out << "  window:            offset " << skipCount << ", limit " << maxCount << "\n";
+    }
+    out << "  estimate:          " << chosen.estimatedRows << " rows, cost "
+        << static_cast<std::int64_t>(chosen.estimatedCost + 0.5) << "\n";
+
+    return out.str();
+}
+
+bool TransactionQuery::aggregateSlice(const QueryPlan& chosen, std::int64_t& sum, size_t& count) const {
+    // Whole contiguous slices go through the vectorized kernels
+    if (chosen.path != AccessPath::DATE_SLICE || skipCount != 0 || maxCount != std::numeric_limits<size_t>::max()) {
+        return false;
+    }
+
+    AggregationKernels::Mask mask;
+    mask.filterType = filterType;
+    mask.type = type;
+    mask.filterCategory = filterCategory;
+    mask.categoryId = categoryId;
+    mask.minCents = minCents;
+    mask.maxCents = maxCents;
+
+    auto result = aggregator->reduce<AggregationKernels::Aggregate>(chosen.firstRow, chosen.lastRow,
+        [this, &mask](size_t first, size_t end) {
+            return AggregationKernels::aggregate(store->amountCents().data() + first, store->types().data() + first,
+                store->categoryIds().data() + first, end - first, mask);
+        },
+        [](AggregationKernels::Aggregate& into, AggregationKernels::Aggregate&& next) {
+            into.sum += next.sum;
+            into.count += next.count;
+        });
+
+    sum = result.sum;
+    count = result.count;
+    return true;
+}
+
+template <typename Visitor>
+void TransactionQuery::scan(const QueryPlan& chosen, Visitor&& visit) const {
+    if (chosen.path == AccessPath::EMPTY) {
+        return;
+    }
+
+    size_t skipped = 0;
+    size_t taken = 0;
+
+    // Returns false once the window is full
+    auto emit = [&](size_t row) {
+        if (!matches(row)) {
+            return true;
+        }
+        if (skipped < skipCount) {
+            ++skipped;
+            return true;
+        }
+        visit(row);
+        return ++taken < maxCount;
+    };
+
+    switch (chosen.path) {
+    case AccessPath::DATE_SLICE:
+        for (size_t row = chosen.lastRow; row-- > chosen.firstRow;) {
+            if (!emit(row)) {
+                return;
+            }
+        }
+        break;
+
+    case AccessPath::CATEGORY_POSTINGS: {
+        auto [begin, end] = categoryRange(chosen.firstRow, chosen.lastRow);
+        for (const auto* it = end; it != begin;) {
+            if (!emit(*--it)) {
+                return;
+            }
+        }
+        break;
+    }
+
+    case AccessPath::AMOUNT_RANGE: {
+        std::vector<std::uint64_t> bits = amountBitmap(chosen.firstRow, chosen.lastRow);
+
+        // Walk set bits from the highest row down
+        for (size_t word = bits.size(); word-- > 0;) {
+            for (std::uint64_t value = bits[word]; value != 0;) {
+                int bit = 63 - std::countl_zero(value);
+                value &= ~(std::uint64_t(1) << bit);
+                if (!emit(chosen.firstRow + word * 64 + bit)) {
+                    return;
+                }
+            }
+        }
+        break;
+    }
+
+    case AccessPath::CATEGORY_AMOUNT: {
+        std::vector<std::uint64_t> bits = amountBitmap(chosen.firstRow, chosen.lastRow);
+        auto [begin, end] = categoryRange(chosen.firstRow, chosen.lastRow);
+
+        for (const auto* it = end; it != begin;) {
+            size_t offset = *--it - chosen.firstRow;
+            if ((bits[offset / 64] >> (offset % 64)) & 1) {
+                if (!emit(*it)) {
+                    return;
+                }
+            }
+        }
+        break;
+    }
+
+    case AccessPath::EMPTY:
+        break;
+    }
+}
+
+TransactionView TransactionQuery::view() const {
+    std::vector<TransactionStore::RowIndex> rows;
+    scan(plan(), [&rows](size_t row) {
+        rows.push_back(static_cast<TransactionStore::RowIndex>(row));
+    });
+
+    // Views hold rows in ascending order
+    std::reverse(rows.begin(), rows.end());
+    return TransactionView(*store, std::move(rows));
+}
+
+std::vector<std::shared_ptr<Transaction>> TransactionQuery::execute() const {
+    std::vector<std::shared_ptr<Transaction>> result;
+    scan(plan(), [this, &result](size_t row) {
+        result.push_back(store->materialize(row));
+    });
+    return result;
+}
+
+size_t TransactionQuery::count() const {
+    QueryPlan chosen = plan();
+    std::int64_t sum = 0;
+    size_t total = 0;
+    if (aggregateSlice(chosen, sum, total)) {
+        return total;
+    }
+
+    scan(chosen, [&total](size_t) {
+        ++total;
+    });
+    return total;
+}
+
+Money TransactionQuery::sum() const {
+    QueryPlan chosen = plan();
+    std::int64_t total = 0;
+    size_t count = 0;
+    if (aggregateSlice(chosen, total, count)) {
+        return Money::fromCents(total);
+    }
+
+    const auto& amounts = store->amountCents();
+    scan(chosen, [&amounts, &total](size_t row) {
+        total += amounts[row];
+    });
+    return Money::fromCents(total);
+}
+
+TransactionView TransactionQuery::topK(size_t k) const {
+    QueryPlan chosen = plan();
+    if (k == 0 || chosen.path == AccessPath::EMPTY) {
+        return TransactionView(*store, std::vector<TransactionStore::RowIndex>());
+    }
+
+    const auto& amounts = store->amountCents();
+
+    // Larger amount first; among equal amounts the newer row wins
+    auto larger = [&amounts](TransactionStore::RowIndex a, TransactionStore::RowIndex b) {
+        return amounts[a] != amounts[b] ? amounts[a] > amounts[b] : a > b;
+    };
+
+    std::vector<TransactionStore::RowIndex> rows;
+
+    // The amount index is a maintained descending walk: stop after k hits
+    // instead of visiting every candidate. Worth it when hits are dense.
+    const bool windowed = skipCount != 0 || maxCount != std::numeric_limits<size_t>::max();
+    auto [begin, end] = amountIndex->findRange(*store, minCents, maxCents);
+    double hitRate = (end > begin) ? static_cast<double>(chosen.estimatedRows) / (end - begin) : 0.0;
+    double walkCost = (hitRate > 0.0) ? k / hitRate * RANDOM_ROW_COST : std::numeric_limits<double>::infinity();
+    double heapCost = chosen.estimatedCost + chosen.estimatedRows * std::log2(static_cast<double>(k) + 1.0);
+
+    if (!windowed && walkCost < heapCost) {
+        const auto& rowsByAmount = amountIndex->rows();
+        for (size_t position = end; position-- > begin;) {
+            TransactionStore::RowIndex row = rowsByAmount[position];
+
+            // Once k rows are found, keep going only through ties with the k-th amount
+            if (rows.size() >= k && amounts[row] < amounts[rows.back()]) {
+                break;
+            }
+            if (row >= chosen.firstRow && row < chosen.lastRow && matches(row)) {
+                rows.push_back(row);
+            }
+        }
+
+        std::sort(rows.begin(), rows.end(), larger);
+        if (rows.size() > k) {
+            rows.resize(k);
+        }
+    }
+    else {
+        // Bounded heap whose top is the smallest of the k kept so far
+        rows.reserve(k);
+        scan(chosen, [&](size_t row) {
+            auto candidate = static_cast<TransactionStore::RowIndex>(row);
+            if (rows.size() < k) {
+                rows.push_back(candidate);
+                std::push_heap(rows.begin(), rows.end(), larger);
+            }
+            else if (larger(candidate, rows.front())) {
+                std::pop_heap(rows.begin(), rows.end(), larger);
+                rows.back() = candidate;
+                std::push_heap(rows.begin(), rows.end(), larger);
+            }
+        });
+
+        std::sort_heap(rows.begin(), rows.end(), larger);
+    }
+
+    // Views read their list back to front, so store smallest first
+    std::reverse(rows.begin(), rows.end());
+    return TransactionView(*store, std::move(rows));
+}
+
+std::map<MonthKey, Money> TransactionQuery::sumByMonth() const {
+    const auto& amounts = store->amountCents();
+    const auto& monthKeys = store->monthKeys();
+    std::map<MonthKey, Money> totals;
+    scan(plan(), [&](size_t row) {
+        totals[monthKeys[row]] += Money::fromCents(amounts[row]);
+    });
+    return totals;
+}
+
+std::map<CategoryId, Money> TransactionQuery::sumByCategory() const {
+    const auto& amounts = store->amountCents();
+    const auto& categories = store->categoryIds();
+    std::map<CategoryId, Money> totals;
+    scan(plan(), [&](size_t row) {
+        totals[categories[row]] += Money::fromCents(amounts[row]);
+    });
+    return totals;
+}
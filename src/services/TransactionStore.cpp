@@ -0,0 +1,134 @@
+#include "../../include/services/TransactionStore.h"
+#include <algorithm>
+#include <numeric>
+#include <iterator>
+
+namespace {
+    // Reorders a column according to a permutation of row indices
+    template <typename T>
+    void applyPermutation(std::vector<T>& column, const std::vector<size_t>& order) {
+        std::vector<T> reordered;
+        reordered.reserve(column.size());
+        for (size_t index : order) {
+            reordered.push_back(std::move(column[index]));
+        }
+        column.swap(reordered);
+    }
+}
+
+void TransactionStore::clear() {
+    dateColumn.clear();
+    amountColumn.clear();
+    typeColumn.clear();
+    categoryColumn.clear();
+    monthKeyColumn.clear();
+    dayKeyColumn.clear();
+}
+
+void TransactionStore::reserve(size_t rowCount) {
+    dateColumn.reserve(rowCount);
+    amountColumn.reserve(rowCount);
+    typeColumn.reserve(rowCount);
+    categoryColumn.reserve(rowCount);
+    monthKeyColumn.reserve(rowCount);
+    dayKeyColumn.reserve(rowCount);
+}
+
+void TransactionStore::append(const Transaction& transaction) {
+    dateColumn.push_back(transaction.getDate());
+    amountColumn.push_back(transaction.getAmount().getCents());
+    typeColumn.push_back(transaction.getType());
+    categoryColumn.push_back(transaction.getCategoryId());
+    monthKeyColumn.push_back(transaction.getMonthKey());
+    dayKeyColumn.push_back(transaction.getDayKey());
+}
+
+size_t TransactionStore::insert(const Transaction& transaction) {
+    // Fast path: rows normally arrive in date order
+    if (dateColumn.empty() || dateColumn.back() <= transaction.getDate()) {
+        append(transaction);
+        return dateColumn.size() - 1;
+    }
+
+    size_t row = static_cast<size_t>(
+        std::upper_bound(dateColumn.begin(), dateColumn.end(), transaction.getDate()) - dateColumn.begin());
+
+    dateColumn.insert(dateColumn.begin() + row, transaction.getDate());
+    amountColumn.insert(amountColumn.begin() + row, transaction.getAmount().getCents());
+    typeColumn.insert(typeColumn.begin() + row, transaction.getType());
+    categoryColumn.insert(categoryColumn.begin() + row, transaction.getCategoryId());
+    monthKeyColumn.insert(monthKeyColumn.begin() + row, transaction.getMonthKey());
+    dayKeyColumn.insert(dayKeyColumn.begin() + row, transaction.getDayKey());
+    return row;
+}
+
+bool TransactionStore::insertBatch(const std::vector<std::shared_ptr<Transaction>>& batch) {
+    size_t firstNew = size();
+    reserve(firstNew + batch.size());
+
+    for (const auto& transaction : batch) {
+        append(*transaction);
+    }
+
+    return mergeFrom(firstNew);
+}
+
+bool TransactionStore::mergeFrom(size_t firstNew) {
+    if (firstNew >= dateColumn.size()) {
+        return true;
+    }
+
+    // Common case: the batch is already sorted and starts after the existing rows
+    bool newRowsSorted = std::is_sorted(dateColumn.begin() + firstNew, dateColumn.end());
+    if (newRowsSorted && (firstNew == 0 || dateColumn[firstNew - 1] <= dateColumn[firstNew])) {
+        return true;
+    }
+
+    auto byDate = [this](size_t a, size_t b) {
+        return dateColumn[a] < dateColumn[b];
+    };
+
+    // Sort only the new rows
+    std::vector<size_t> order(dateColumn.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto newRows = order.begin() + firstNew;
+    if (!newRowsSorted) {
+        std::stable_sort(newRows, order.end(), byDate);
+    }
+
+    // Linear merge; existing rows stay ahead of new rows with the same date
+    if (firstNew > 0 && dateColumn[*newRows] < dateColumn[firstNew - 1]) {
+        std::vector<size_t> merged;
+        merged.reserve(order.size());
+        std::merge(order.begin(), newRows, newRows, order.end(), std::back_inserter(merged), byDate);
+        order.swap(merged);
+    }
+
+    applyPermutation(dateColumn, order);
+    applyPermutation(amountColumn, order);
+    applyPermutation(typeColumn, order);
+    applyPermutation(categoryColumn, order);
+    applyPermutation(monthKeyColumn, order);
+    applyPermutation(dayKeyColumn, order);
+    return false;
+}
+
+std::pair<size_t, size_t> TransactionStore::findDayRange(DayKey firstDay, DayKey lastDay) const {
+    if (firstDay > lastDay) {
+        return { 0, 0 };
+    }
+
+    auto begin = std::lower_bound(dayKeyColumn.begin(), dayKeyColumn.end(), firstDay);
+    auto end = std::upper_bound(begin, dayKeyColumn.end(), lastDay);
+    return { static_cast<size_t>(begin - dayKeyColumn.begin()), static_cast<size_t>(end - dayKeyColumn.begin()) };
+}
+
+std::pair<size_t, size_t> TransactionStore::findMonthRange(MonthKey month) const {
+    auto range = std::equal_range(monthKeyColumn.begin(), monthKeyColumn.end(), month);
+    return { static_cast<size_t>(range.first - monthKeyColumn.begin()), static_cast<size_t>(range.second - monthKeyColumn.begin()) };
+}
+
+std::shared_ptr<Transaction> TransactionStore::materialize(size_t row) const {
+    return std::make_shared<Transaction>(Money::fromCents(amountColumn[row]), dateColumn[row],
+        categoryColumn[row], typeColumn[row]);
+}
@@ -0,0 +1,51 @@
+#include "../../include/services/TransactionView.h"
+#include "../../include/utils/DateUtils.h"
+
+std::string TransactionRef::getCategory() const {
+    return CategoryDictionary::instance().getName(getCategoryId());
+}
+
+std::string TransactionRef::getFormattedDate() const {
+    return DateUtils::formatDayKey(getDayKey());
+}
+
+std::string TransactionRef::getFormattedAmount() const {
+    return Transaction::formatAmount(getAmount(), getType());
+}
+
+std::string TransactionRef::getTypeAsString() const {
+    return Transaction::typeToString(getType());
+}
+
+std::string TransactionRef::getDisplayString() const {
+    return Transaction::formatDisplayString(getFormattedDate(), getType(), getCategory(), getAmount());
+}
+
+TransactionView::TransactionView()
+    : store(nullptr), first(0), last(0), rowList(nullptr), count(0) {
+}
+
+TransactionView::TransactionView(const TransactionStore& store, size_t first, size_t last)
+    : store(&store), first(first), last(last), rowList(nullptr), count(0) {
+}
+
+TransactionView::TransactionView(const TransactionStore& store, const TransactionStore::RowIndex* rows, size_t count)
+    : store(&store), first(0), last(0), rowList(rows), count(count) {
+}
+
+TransactionView::TransactionView(const TransactionStore& store, std::vector<TransactionStore::RowIndex> rows)
+    : store(&store), first(0), last(0), rowList(nullptr), count(rows.size()),
+    ownedRows(std::make_shared<const std::vector<TransactionStore::RowIndex>>(std::move(rows))) {
+    rowList = ownedRows->data();
+}
+
+std::vector<std::shared_ptr<Transaction>> TransactionView::materialize() const {
+    std::vector<std::shared_ptr<Transaction>> result;
+    result.reserve(size());
+
+    for (size_t index = 0; index < size(); ++index) {
+        result.push_back(store->materialize(rowAt(index)));
+    }
+
+    return result;
+}
@@ -74,6 +74,7 @@ void BudgetUI::showBudgetsByCategory() {
 
 void BudgetUI::showBudgetsByMonth() {
     std::string yearMonth;
+    MonthKey monthKey = 0;
     std::cout << "\n===== View Budgets by Month =====\n";
 
     // Get and validate year-month
@@ -83,32 +84,17 @@ void BudgetUI::showBudgetsByMonth() {
         std::getline(std::cin, yearMonth);
 
         try {
-            // First check basic format using DateUtils
-            if (!DateUtils::validateYearMonth(yearMonth)) {
+            if (!DateUtils::parseYearMonth(yearMonth, monthKey)) {
                 throw std::invalid_argument("Invalid year-month format");
             }
-
-            // Then extract values and validate range using Budget method
-            size_t dashPos = yearMonth.find('-');
-            if (dashPos != std::string::npos) {
-                int year = std::stoi(yearMonth.substr(0, dashPos));
-                int month = std::stoi(yearMonth.substr(dashPos + 1));
-
-                // This will throw if month or year is invalid
-                Budget::createYearMonthString(year, month);
-
-                validYearMonth = true;
-            }
-            else {
-                throw std::invalid_argument("Missing dash separator");
-            }
+            validYearMonth = true;
         }
         catch (const std::exception& e) {
             std::cout << "Invalid input: " << e.what() << ". Please use YYYY-MM format (e.g., 2023-06).\n";
         }
     }
 
-    auto budgets = budgetManager->getBudgetsByYearMonth(yearMonth);
+    auto budgets = budgetManager->getBudgetsByYearMonth(monthKey);
 
     if (budgets.empty()) {
         std::cout << "No budgets found for month '" << yearMonth << "'.\n";
@@ -121,7 +107,9 @@ void BudgetUI::showBudgetsByMonth() {
 
 void BudgetUI::setBudget() {
     std::string category, yearMonth;
+    MonthKey monthKey = 0;
     double limitAmount;
+    Money limit;
 
     std::cout << "\n===== Set New Budget Limit =====\n";
 
@@ -136,25 +124,10 @@ void BudgetUI::setBudget() {
         std::getline(std::cin, yearMonth);
 
         try {
-            // First check basic format using DateUtils
-            if (!DateUtils::validateYearMonth(yearMonth)) {
+            if (!DateUtils::parseYearMonth(yearMonth, monthKey)) {
                 throw std::invalid_argument("Invalid year-month format");
             }
-
-            // Then extract values and validate range using Budget method
-            size_t dashPos = yearMonth.find('-');
-            if (dashPos != std::string::npos) {
-                int year = std::stoi(yearMonth.substr(0, dashPos));
-                int month = std::stoi(yearMonth.substr(dashPos + 1));
-
-                // This will throw if month or year is invalid
-                Budget::createYearMonthString(year, month);
-
-                validYearMonth = true;
-            }
-            else {
-                throw std::invalid_argument("Missing dash separator");
-            }
+            validYearMonth = true;
         }
         catch (const std::exception& e) {
             std::cout << "Invalid input: " << e.what() << ". Please use YYYY-MM format (e.g., 2023-06).\n";
@@ -177,12 +150,17 @@ void BudgetUI::setBudget() {
             continue;
         }
 
+        if (!Money::tryFromDouble(limitAmount, limit)) {
+            std::cout << "Budget limit amount is too large. Please try again.\n";
+            continue;
+        }
+
         break;
     }
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
     // Check if budget already exists
-    if (budgetManager->hasBudget(category, yearMonth)) {
+    if (budgetManager->hasBudget(category, monthKey)) {
         char choice;
         std::cout << "A budget already exists for " << category << " in " << yearMonth << ".\n";
         std::cout << "Do you want to update it? (y/n): ";
@@ -196,7 +174,7 @@ void BudgetUI::setBudget() {
     }
 
     // Create and add/update budget
-    auto budget = std::make_shared<Budget>(category, yearMonth, limitAmount);
+    auto budget = std::make_shared<Budget>(category, monthKey, limit);
     budgetManager->addBudget(budget);
 
     std::cout << "Budget successfully set: " << budget->getDisplayString() << std::endl;
@@ -204,7 +182,9 @@ void BudgetUI::setBudget() {
 
 void BudgetUI::updateBudget() {
     std::string category, yearMonth;
+    MonthKey monthKey = 0;
     double newLimit;
+    Money limit;
 
     std::cout << "\n===== Update Existing Budget =====\n";
 
@@ -219,25 +199,10 @@ void BudgetUI::updateBudget() {
         std::getline(std::cin, yearMonth);
 
         try {
-            // First check basic format using DateUtils
-            if (!DateUtils::validateYearMonth(yearMonth)) {
+            if (!DateUtils::parseYearMonth(yearMonth, monthKey)) {
                 throw std::invalid_argument("Invalid year-month format");
             }
-
-            // Then extract values and validate range using Budget method
-            size_t dashPos = yearMonth.find('-');
-            if (dashPos != std::string::npos) {
-                int year = std::stoi(yearMonth.substr(0, dashPos));
-                int month = std::stoi(yearMonth.substr(dashPos + 1));
-
-                // This will throw if month or year is invalid
-                Budget::createYearMonthString(year, month);
-
-                validYearMonth = true;
-            }
-            else {
-                throw std::invalid_argument("Missing dash separator");
-            }
+            validYearMonth = true;
         }
         catch (const std::exception& e) {
             std::cout << "Invalid input: " << e.what() << ". Please use YYYY-MM format (e.g., 2023-06).\n";
@@ -245,7 +210,7 @@ void BudgetUI::updateBudget() {
     }
 
     // Check if the budget exists
-    auto existingBudget = budgetManager->getBudget(category, yearMonth);
+    auto existingBudget = budgetManager->getBudget(category, monthKey);
     if (!existingBudget) {
         std::cout << "No budget found for " << category << " in " << yearMonth << ".\n";
 
@@ -279,17 +244,22 @@ void BudgetUI::updateBudget() {
             continue;
         }
 
+        if (!Money::tryFromDouble(newLimit, limit)) {
+            std::cout << "Budget limit amount is too large. Please try again.\n";
+            continue;
+        }
+
         break;
     }
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
     // Update the budget
-    budgetManager->updateBudget(category, yearMonth, newLimit);
+    budgetManager->updateBudget(category, monthKey, limit);
 
     std::cout << "Budget successfully updated.\n";
 
     // Display the updated budget
-    auto updatedBudget = budgetManager->getBudget(category, yearMonth);
+    auto updatedBudget = budgetManager->getBudget(category, monthKey);
     if (updatedBudget) {
         std::cout << "New budget: " << updatedBudget->getDisplayString() << std::endl;
     }
@@ -297,6 +267,7 @@ void BudgetUI::updateBudget() {
 
 void BudgetUI::removeBudget() {
     std::string category, yearMonth;
+    MonthKey monthKey = 0;
 
     std::cout << "\n===== Remove Budget =====\n";
 
@@ -311,25 +282,10 @@ void BudgetUI::removeBudget() {
         std::getline(std::cin, yearMonth);
 
         try {
-            // First check basic format using DateUtils
-            if (!DateUtils::validateYearMonth(yearMonth)) {
+            if (!DateUtils::parseYearMonth(yearMonth, monthKey)) {
                 throw std::invalid_argument("Invalid year-month format");
             }
-
-            // Then extract values and validate range using Budget method
-            size_t dashPos = yearMonth.find('-');
-            if (dashPos != std::string::npos) {
-                int year = std::stoi(yearMonth.substr(0, dashPos));
-                int month = std::stoi(yearMonth.substr(dashPos + 1));
-
-                // This will throw if month or year is invalid
-                Budget::createYearMonthString(year, month);
-
-                validYearMonth = true;
-            }
-            else {
-                throw std::invalid_argument("Missing dash separator");
-            }
+            validYearMonth = true;
         }
         catch (const std::exception& e) {
             std::cout << "Invalid input: " << e.what() << ". Please use YYYY-MM format (e.g., 2023-06).\n";
@@ -337,7 +293,7 @@ void BudgetUI::removeBudget() {
     }
 
     // Check if the budget exists
-    auto existingBudget = budgetManager->getBudget(category, yearMonth);
+    auto existingBudget = budgetManager->getBudget(category, monthKey);
     if (!existingBudget) {
         std::cout << "No budget found for " << category << " in " << yearMonth << ".\n";
         return;
@@ -356,7 +312,7 @@ void BudgetUI::removeBudget() {
     }
 
     // Remove the budget
-    if (budgetManager->removeBudget(category, yearMonth)) {
+    if (budgetManager->removeBudget(category, monthKey)) {
         std::cout << "Budget successfully removed.\n";
     }
     else {
@@ -367,36 +323,26 @@ void BudgetUI::removeBudget() {
 void BudgetUI::displayBudgetUsage(const std::shared_ptr<Budget>& budget) {
     if (!budget) return;
 
-    // Get the category and year-month from the budget
-    std::string category = budget->getCategory();
-    std::string yearMonth = budget->getYearMonth();
-    double budgetLimit = budget->getLimitAmount();
-
-    // Calculate total expenses for this category and month
-    double totalExpenses = 0.0;
+    // Get the category and month from the budget
+    CategoryId categoryId = budget->getCategoryId();
+    MonthKey monthKey = budget->getMonthKey();
+    Money budgetLimit = budget->getLimitAmount();
 
-    // Get all expense transactions
-    // TransactionType is an enum class defined in Transaction.h
-    auto allTransactions = transactionManager->getTransactionsByType(TransactionType::EXPENSE);
-
-    // Filter by category and month
-    for (const auto& transaction : allTransactions) {
-        if (transaction->getCategory() == category &&
-            transaction->getMonthKey() == yearMonth) {
-            totalExpenses += transaction->getAmount();
-        }
-    }
+    // Total expenses for this category and month, kept up to date by the manager
+    Money totalExpenses = transactionManager->getCategoryMonthSpend(categoryId, monthKey);
 
     // Calculate usage percentage
-    double usagePercentage = (budgetLimit > 0) ? (totalExpenses / budgetLimit) * 100.0 : 0.0;
+    double usagePercentage = (budgetLimit > Money())
+        ? (static_cast<double>(totalExpenses.getCents()) / budgetLimit.getCents()) * 100.0
+        : 0.0;
 
     // Calculate remaining amount
-    double remainingAmount = budgetLimit - totalExpenses;
+    Money remainingAmount = budgetLimit - totalExpenses;
 
     // Display budget usage information
     std::cout << "Budget: " << budget->getDisplayString() << std::endl;
-    std::cout << "Total Spent: $" << std::fixed << std::setprecision(2) << totalExpenses << std::endl;
-    std::cout << "Remaining: $" << std::fixed << std::setprecision(2) << remainingAmount << std::endl;
+    std::cout << "Total Spent: $" << totalExpenses << std::endl;
+    std::cout << "Remaining: $" << remainingAmount << std::endl;
     std::cout << "Usage: " << std::fixed << std::setprecision(1) << usagePercentage << "%" << std::endl;
 
     // Visual representation of the budget usage
@@ -418,12 +364,10 @@ void BudgetUI::displayBudgetUsage(const std::shared_ptr<Budget>& budget) {
 
     // Status message based on budget usage
     if (usagePercentage > 100) {
-        std::cout << "Status: OVER BUDGET by $"
-            << std::fixed << std::setprecision(2) << -remainingAmount << std::endl;
+        std::cout << "Status: OVER BUDGET by $" << -remainingAmount << std::endl;
     }
     else if (usagePercentage >= 90) {
-        std::cout << "Status: NEAR LIMIT ($"
-            << std::fixed << std::setprecision(2) << remainingAmount << " remaining)" << std::endl;
+        std::cout << "Status: NEAR LIMIT ($" << remainingAmount << " remaining)" << std::endl;
     }
     else if (usagePercentage >= 75) {
         std::cout << "Status: MODERATE USAGE" << std::endl;
@@ -437,23 +381,24 @@ void BudgetUI::displayBudgetUsage(const std::shared_ptr<Budget>& budget) {
 
 void BudgetUI::showBudgetUsageReport() {
     std::string yearMonth;
+    MonthKey monthKey = 0;
 
     std::cout << "\n===== Budget Usage Report =====\n";
 
     // Default to current month
-    time_t now = time(nullptr);
-    tm* localTime = localtime(&now);
+    MonthKey defaultMonthKey = DateUtils::currentMonthKey();
+    int currentYear = DateUtils::monthKeyYear(defaultMonthKey);
 
     // Try to create the default year-month with validation
     std::string defaultYearMonth;
     try {
         defaultYearMonth = Budget::createYearMonthString(
-            localTime->tm_year + 1900, localTime->tm_mon + 1);
+            currentYear, DateUtils::monthKeyMonth(defaultMonthKey));
     }
     catch (const std::invalid_argument& e) {
         std::cerr << "Error creating default month: " << e.what() << std::endl;
         // Fallback to current year and January if system time is problematic
-        defaultYearMonth = std::to_string(localTime->tm_year + 1900) + "-01";
+        defaultYearMonth = std::to_string(currentYear) + "-01";
     }
 
     // Get and validate year-month, with option to use default
@@ -463,31 +408,16 @@ void BudgetUI::showBudgetUsageReport() {
 
     if (yearMonth.empty()) {
         yearMonth = defaultYearMonth;
+        monthKey = defaultMonthKey;
     }
     else {
         bool validInput = false;
         while (!validInput) {
             try {
-                // Validate the input format and values
-                if (!DateUtils::validateYearMonth(yearMonth)) {
+                if (!DateUtils::parseYearMonth(yearMonth, monthKey)) {
                     throw std::invalid_argument("Invalid year-month format");
                 }
-
-                // Additional validation (extract and check values)
-                size_t dashPos = yearMonth.find('-');
-                if (dashPos != std::string::npos) {
-                    int year = std::stoi(yearMonth.substr(0, dashPos));
-                    int month = std::stoi(yearMonth.substr(dashPos + 1));
-
-                    // Use Budget::createYearMonthString for validation
-                    // This will throw if month is invalid
-                    Budget::createYearMonthString(year, month);
-
-                    validInput = true;
-                }
-                else {
-                    throw std::invalid_argument("Missing dash separator");
-                }
+                validInput = true;
             }
             catch (const std::exception& e) {
                 std::cout << "Invalid input: " << e.what() << ". Please use YYYY-MM format (e.g., 2023-06): ";
@@ -495,6 +425,7 @@ void BudgetUI::showBudgetUsageReport() {
 
                 if (yearMonth.empty()) {
                     yearMonth = defaultYearMonth;
+                    monthKey = defaultMonthKey;
                     validInput = true;
                 }
             }
@@ -502,7 +433,7 @@ void BudgetUI::showBudgetUsageReport() {
     }
 
     // Get all budgets for the specified month
-    auto budgets = budgetManager->getBudgetsByYearMonth(yearMonth);
+    auto budgets = budgetManager->getBudgetsByYearMonth(monthKey);
 
     if (budgets.empty()) {
         std::cout << "No budgets found for month " << yearMonth << ".\n";
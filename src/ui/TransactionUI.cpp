@@ -16,8 +16,9 @@ void TransactionUI::displayTransactionsMenu() const {
     std::cout << "6. View by Month\n";
     std::cout << "7. View Monthly Summary\n";
     std::cout << "8. Add New Transaction\n";     // Moved this down by one
+    std::cout << "9. Largest Transactions\n";
     std::cout << "0. Back to Main Menu\n";
-    std::cout << "Enter your choice (0-8): ";    // Updated range
+    std::cout << "Enter your choice (0-9): ";    // Updated range
 }
 
 void TransactionUI::displayTransactionHeader() const {
@@ -30,32 +31,37 @@ void TransactionUI::displayTransactionHeader() const {
     std::cout << std::string(55, '-') << "\n";
 }
 
-void TransactionUI::displayTransactions(const std::vector<std::shared_ptr<Transaction>>& transactions) const {
-    for (const auto& transaction : transactions) {
-        std::cout << std::left << std::setw(12) << transaction->getFormattedDate()
-            << std::setw(12) << transaction->getTypeAsString()
-            << std::setw(15) << transaction->getCategory()
-            << std::right << std::setw(15) << transaction->getFormattedAmount()
+void TransactionUI::displayTransactions(const TransactionView& transactions) const {
+    for (const TransactionRef transaction : transactions) {
+        std::cout << std::left << std::setw(12) << transaction.getFormattedDate()
+            << std::setw(12) << transaction.getTypeAsString()
+            << std::setw(15) << transaction.getCategory()
+            << std::right << std::setw(15) << transaction.getFormattedAmount()
             << "\n";
     }
     std::cout << std::string(55, '-') << "\n";
 }
 
 void TransactionUI::displayFinancialSummary() const {
-    double totalIncome = transactionManager->getTotalIncome();
-    double totalExpenses = transactionManager->getTotalExpenses();
-    double netAmount = transactionManager->getNetAmount();
+    FinancialSummary summary = transactionManager->getFinancialSummary();
+    Money netAmount = summary.netAmount;
 
     std::cout << "\n===== Financial Summary =====\n";
-    std::cout << "Total Income: $" << std::fixed << std::setprecision(2) << totalIncome << "\n";
-    std::cout << "Total Expenses: $" << std::fixed << std::setprecision(2) << totalExpenses << "\n";
-    std::cout << "Net Amount: $" << std::fixed << std::setprecision(2) << netAmount << "\n";
+    std::cout << "Total Income: $" << summary.totalIncome << " (" << summary.incomeCount << " transactions)\n";
+    std::cout << "Total Expenses: $" << summary.totalExpenses << " (" << summary.expenseCount << " transactions)\n";
+    std::cout << "Net Amount: $" << netAmount << "\n";
+
+    if (summary.transactionCount > 0) {
+        std::cout << "Smallest / Largest Transaction: $" << summary.minAmount
+            << " / $" << summary.maxAmount << "\n";
+        std::cout << "Average Transaction: $" << summary.meanAmount << "\n";
+    }
 
-    if (netAmount > 0) {
-        std::cout << "Status: You have a surplus of $" << std::fixed << std::setprecision(2) << netAmount << "\n";
+    if (netAmount > Money()) {
+        std::cout << "Status: You have a surplus of $" << netAmount << "\n";
     }
-    else if (netAmount < 0) {
-        std::cout << "Status: You have a deficit of $" << std::fixed << std::setprecision(2) << std::abs(netAmount) << "\n";
+    else if (netAmount < Money()) {
+        std::cout << "Status: You have a deficit of $" << -netAmount << "\n";
     }
     else {
         std::cout << "Status: Your budget is balanced (income equals expenses)\n";
@@ -72,18 +78,27 @@ void TransactionUI::displayMonthlySummaryHeader() const {
     std::cout << std::string(60, '-') << "\n";
 }
 
-bool TransactionUI::validateDoubleInput(double& value, const std::string& prompt) const {
-    std::cout << prompt;
-    std::cin >> value;
+bool TransactionUI::validateAmountInput(Money& amount, const std::string& prompt) const {
+    while (true) {
+        double value = 0.0;
+        std::cout << prompt;
+        std::cin >> value;
 
-    if (std::cin.fail() || value < 0) {
-        std::cin.clear();
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        std::cout << "Invalid input. Please enter a positive number.\n";
-        return false;
-    }
+        if (std::cin.fail() || value < 0) {
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            std::cout << "Invalid input. Please enter a positive number.\n";
+            return false;
+        }
 
-    return true;
+        if (!Money::tryFromDouble(value, amount)) {
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            std::cout << "Amount is too large. Please try again.\n";
+            continue;
+        }
+
+        return true;
+    }
 }
 
 bool TransactionUI::validateDateInput(std::string& dateStr, const std::string& prompt) const {
@@ -112,12 +127,12 @@ bool TransactionUI::validateCategoryInput(std::string& category, const std::stri
 }
 
 std::shared_ptr<Transaction> TransactionUI::createTransaction(TransactionType type) {
-    double amount = 0.0;
+    Money amount;
     std::string dateStr;
     std::string category;
 
     // Get and validate transaction amount
-    if (!validateDoubleInput(amount, "Enter amount ($): ")) {
+    if (!validateAmountInput(amount, "Enter amount ($): ")) {
         return nullptr;
     }
 
@@ -137,7 +152,7 @@ std::shared_ptr<Transaction> TransactionUI::createTransaction(TransactionType ty
 }
 
 void TransactionUI::showAllTransactions() const {
-    auto transactions = transactionManager->getAllTransactions();
+    auto transactions = transactionManager->viewAll();
 
     if (transactions.empty()) {
         std::cout << "\nNo transactions found.\n";
@@ -157,7 +172,7 @@ void TransactionUI::showTransactionsByCategory() const {
     std::cin.ignore(); // Clear previous input
     std::getline(std::cin, category);
 
-    auto transactions = transactionManager->getTransactionsByCategory(category);
+    auto transactions = transactionManager->viewByCategory(category);
 
     if (transactions.empty()) {
         std::cout << "No transactions found for category '" << category << "'.\n";
@@ -185,7 +200,7 @@ void TransactionUI::showTransactionsByType() const {
     }
 
     TransactionType type = (typeChoice == 1) ? TransactionType::INCOME : TransactionType::EXPENSE;
-    auto transactions = transactionManager->getTransactionsByType(type);
+    auto transactions = transactionManager->viewByType(type);
 
     if (transactions.empty()) {
         std::cout << "No " << ((type == TransactionType::INCOME) ? "income" : "expense") << " transactions found.\n";
@@ -218,7 +233,7 @@ void TransactionUI::showTransactionsByDateRange() const {
         return;
     }
 
-    auto transactions = transactionManager->getTransactionsByDateRange(startDate, endDate);
+    auto transactions = transactionManager->viewByDateRange(startDate, endDate);
 
     if (transactions.empty()) {
         std::cout << "No transactions found between " << startDateStr << " and " << endDateStr << ".\n";
@@ -230,12 +245,18 @@ void TransactionUI::showTransactionsByDateRange() const {
 
     std::cout << "\nFound " << transactions.size() << " transaction(s) between "
         << startDateStr << " and " << endDateStr << ".\n";
+
+    Money rangeIncome = transactionManager->sumRange(startDate, endDate, TransactionType::INCOME);
+    Money rangeExpenses = transactionManager->sumRange(startDate, endDate, TransactionType::EXPENSE);
+    std::cout << "Income: $" << rangeIncome << "  Expenses: $" << rangeExpenses
+        << "  Net: $" << (rangeIncome - rangeExpenses) << "\n";
 }
 
 void TransactionUI::showTransactionsByAmountRange() {
     std::cout << "\n===== Filter Transactions by Amount Range =====\n";
 
     double minAmount, maxAmount;
+    Money minMoney, maxMoney;
 
     // Get minimum amount with validation
     while (true) {
@@ -250,6 +271,10 @@ void TransactionUI::showTransactionsByAmountRange() {
             std::cout << "Minimum amount cannot be negative. Please try again.\n";
             continue;
         }
+        if (!Money::tryFromDouble(minAmount, minMoney)) {
+            std::cout << "Minimum amount is too large. Please try again.\n";
+            continue;
+        }
         break;
     }
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -271,13 +296,17 @@ void TransactionUI::showTransactionsByAmountRange() {
             std::cout << "Maximum amount must be greater than or equal to minimum amount (" << minAmount << "$). Please try again.\n";
             continue;
         }
+        if (!Money::tryFromDouble(maxAmount, maxMoney)) {
+            std::cout << "Maximum amount is too large. Please try again.\n";
+            continue;
+        }
         break;
     }
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
     // Get filtered transactions
-    std::vector<std::shared_ptr<Transaction>> filteredTransactions =
-        transactionManager->getTransactionsByAmountRange(minAmount, maxAmount);
+    TransactionView filteredTransactions =
+        transactionManager->viewByAmountRange(minMoney, maxMoney);
 
     if (filteredTransactions.empty()) {
         std::cout << "No transactions found in the range of $" << minAmount << " to $" << maxAmount << ".\n";
@@ -294,21 +323,14 @@ void TransactionUI::showTransactionsByMonth() const {
     std::cout << "\nEnter month (YYYY-MM): ";
     std::cin >> yearMonth;
 
-    if (!DateUtils::validateYearMonth(yearMonth)) {
+    MonthKey monthKey;
+    if (!DateUtils::parseYearMonth(yearMonth, monthKey)) {
         std::cout << "Invalid month format. Please use YYYY-MM format.\n";
         return;
     }
 
-    // Get all transactions
-    auto allTransactions = transactionManager->getAllTransactions();
-
-    // Filter by month manually (assumes getMonthKey() returns YYYY-MM)
-    std::vector<std::shared_ptr<Transaction>> monthTransactions;
-    for (const auto& transaction : allTransactions) {
-        if (transaction->getMonthKey() == yearMonth) {
-            monthTransactions.push_back(transaction);
-        }
-    }
+    // The month's rows are one contiguous block of the ledger
+    auto monthTransactions = transactionManager->viewByMonth(monthKey);
 
     if (monthTransactions.empty()) {
         std::cout << "No transactions found for month " << yearMonth << ".\n";
@@ -322,22 +344,22 @@ void TransactionUI::showTransactionsByMonth() const {
 }
 
 void TransactionUI::showMonthlySummary() const {
-    auto monthlySummary = transactionManager->calculateMonthlySummary();
+    const auto& monthlyTotals = transactionManager->getMonthlyTotals();
 
-    if (monthlySummary.empty()) {
+    if (monthlyTotals.empty()) {
         std::cout << "\nNo transaction data available for monthly summary.\n";
         return;
     }
 
     displayMonthlySummaryHeader();
 
-    for (const auto& [month, summary] : monthlySummary) {
-        double income = std::get<0>(summary);
-        double expenses = std::get<1>(summary);
-        double net = std::get<2>(summary);
+    for (const auto& [month, totals] : monthlyTotals) {
+        Money income = totals.income;
+        Money expenses = totals.expenses;
+        Money net = totals.getNetAmount();
 
-        std::cout << std::left << std::setw(15) << month
-            << std::right << std::fixed << std::setprecision(2)
+        std::cout << std::left << std::setw(15) << DateUtils::formatMonthKey(month)
+            << std::right
             << std::setw(15) << income
             << std::setw(15) << expenses
             << std::setw(15) << net
@@ -347,6 +369,238 @@ void TransactionUI::showMonthlySummary() const {
     std::cout << std::string(60, '-') << "\n";
 }
 
+void TransactionUI::showLargestTransactions() const {
+    std::cout << "\n===== Largest Transactions =====\n";
+
+    int count;
+    std::cout << "How many transactions to show: ";
+    std::cin >> count;
+    if (std::cin.fail() || count <= 0) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "Please enter a positive number. Operation cancelled.\n";
+        return;
+    }
+
+    int typeChoice;
+    std::cout << "1. Expenses\n";
+    std::cout << "2. Income\n";
+    std::cout << "3. Both\n";
+    std::cout << "Enter choice (1-3): ";
+    std::cin >> typeChoice;
+    if (std::cin.fail() || typeChoice < 1 || typeChoice > 3) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "Invalid choice. Operation cancelled.\n";
+        return;
+    }
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    TransactionQuery filter = transactionManager->query();
+    std::string scope;
+
+    if (typeChoice != 3) {
+        filter.ofType(typeChoice == 1 ? TransactionType::EXPENSE : TransactionType::INCOME);
+    }
+
+    std::string yearMonth;
+    std::cout << "Enter month (YYYY-MM), or press Enter for all history: ";
+    std::getline(std::cin, yearMonth);
+    if (!yearMonth.empty()) {
+        MonthKey monthKey;
+        if (!DateUtils::parseYearMonth(yearMonth, monthKey)) {
+            std::cout << "Invalid month format. Please use YYYY-MM format.\n";
+            return;
+        }
+        filter.inMonth(monthKey);
+        scope += " in " + yearMonth;
+    }
+
+    std::string category;
+    std::cout << "Enter category, or press Enter for all categories: ";
+    std::getline(std::cin, category);
+    if (!category.empty()) {
+        filter.inCategory(category);
+        scope += " for '" + category + "'";
+    }
+
+    TransactionView largest = transactionManager->topK(static_cast<size_t>(count), filter);
+
+    if (largest.empty()) {
+        std::cout << "No transactions found" << scope << ".\n";
+        return;
+    }
+
+    std::cout << "\nTop " << largest.size() << " transaction(s) by amount" << scope << ":\n";
+    displayTransactionHeader();
+    displayTransactions(largest);
+}
+
+void TransactionUI::displayQuantileRow(const std::string& label, const QuantileSketch& sketch) const {
+    std::cout << std::left << std::setw(15) << label
+        << std::right
+        << std::setw(8) << sketch.getCount()
+        << std::setw(12) << Money::fromCents(sketch.quantile(0.5))
+        << std::setw(12) << Money::fromCents(sketch.quantile(0.9))
+        << std::setw(12) << Money::fromCents(sketch.quantile(0.99))
+        << std::setw(12) << Money::fromCents(sketch.getMax())
+        << "\n";
+}
+
+void TransactionUI::showExpenseDistributionReport() const {
+    std::cout << "\n===== Expense Size Distribution =====\n";
+    std::cout << "1. By Category\n";
+    std::cout << "2. By Month\n";
+    std::cout << "Enter choice (1-2): ";
+
+    int choice;
+    std::cin >> choice;
+    if (std::cin.fail() || choice < 1 || choice > 2) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "Invalid choice. Operation cancelled.\n";
+        return;
+    }
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    std::map<std::string, QuantileSketch> rows;
+    std::string title;
+
+    if (choice == 1) {
+        std::string yearMonth;
+        std::cout << "Enter month (YYYY-MM), or press Enter for all history: ";
+        std::getline(std::cin, yearMonth);
+
+        std::map<CategoryId, QuantileSketch> sketches;
+        if (yearMonth.empty()) {
+            sketches = transactionManager->getCategoryExpenseSketches();
+            title = "all history";
+        }
+        else {
+            MonthKey monthKey;
+            if (!DateUtils::parseYearMonth(yearMonth, monthKey)) {
+                std::cout << "Invalid month format. Please use YYYY-MM format.\n";
+                return;
+            }
+            sketches = transactionManager->getCategoryExpenseSketches(monthKey);
+            title = yearMonth;
+        }
+
+        for (auto& [categoryId, sketch] : sketches) {
+            rows.emplace(CategoryDictionary::instance().getName(categoryId), std::move(sketch));
+        }
+    }
+    else {
+        for (auto& [month, sketch] : transactionManager->getMonthlyExpenseSketches()) {
+            rows.emplace(DateUtils::formatMonthKey(month), std::move(sketch));
+        }
+        title = "all categories";
+    }
+
+    if (rows.empty()) {
+        std::cout << "No expense data available.\n";
+        return;
+    }
+
+    std::cout << "\nExpense sizes (" << title << "); quantiles are estimates within ~1% rank\n";
+    std::cout << std::left << std::setw(15) << (choice == 1 ? "Category" : "Month")
+        << std::right
+        << std::setw(8) << "Count"
+        << std::setw(12) << "Median"
+        << std::setw(12) << "P90"
+        << std::setw(12) << "P99"
+        << std::setw(12) << "Max"
+        << "\n";
+    std::cout << std::string(71, '-') << "\n";
+
+    for (const auto& [label, sketch] : rows) {
+        displayQuantileRow(label, sketch);
+    }
+
+    std::cout << std::string(71, '-') << "\n";
+}
+
+void TransactionUI::showRollingSpendReport() const {
+    std::cout << "\n===== Rolling Spend (7/30/90 days) =====\n";
+
+    std::string category;
+    std::cout << "Enter category, or press Enter for all categories: ";
+    std::getline(std::cin, category);
+
+    std::string daysInput;
+    std::cout << "Number of recent days to show (default 14): ";
+    std::getline(std::cin, daysInput);
+
+    size_t dayCount = 14;
+    if (!daysInput.empty()) {
+        try {
+            int parsed = std::stoi(daysInput);
+            if (parsed <= 0) {
+                throw std::invalid_argument("non-positive");
+            }
+            dayCount = static_cast<size_t>(parsed);
+        }
+        catch (const std::exception&) {
+            std::cout << "Invalid number of days. Operation cancelled.\n";
+            return;
+        }
+    }
+
+    // The windows share their first and last day (oldest source row, newest ledger row)
+    RollingWindow weekly(7);
+    RollingWindow monthly(30);
+    RollingWindow quarterly(90);
+    if (category.empty()) {
+        weekly = transactionManager->getRollingSpend(7);
+        monthly = transactionManager->getRollingSpend(30);
+        quarterly = transactionManager->getRollingSpend(90);
+    }
+    else {
+        CategoryId categoryId;
+        if (!CategoryDictionary::instance().find(category, categoryId)) {
+            std::cout << "No expense data available for " << category << ".\n";
+            return;
+        }
+        weekly = transactionManager->getRollingSpend(7, categoryId);
+        monthly = transactionManager->getRollingSpend(30, categoryId);
+        quarterly = transactionManager->getRollingSpend(90, categoryId);
+    }
+
+    if (weekly.empty()) {
+        std::cout << "No expense data available.\n";
+        return;
+    }
+
+    std::cout << "\nTrailing expense totals (" << (category.empty() ? "all categories" : category) << ")\n";
+    std::cout << std::left << std::setw(12) << "Date"
+        << std::right
+        << std::setw(12) << "Day"
+        << std::setw(12) << "7-day"
+        << std::setw(12) << "30-day"
+        << std::setw(12) << "90-day"
+        << std::setw(12) << "30d avg"
+        << "\n";
+    std::cout << std::string(72, '-') << "\n";
+
+    // One line per calendar day, quiet days included
+    const DayKey lastDay = weekly.lastDay();
+    const DayKey requested = static_cast<DayKey>(std::min<size_t>(dayCount, static_cast<size_t>(lastDay - weekly.firstDay()) + 1));
+    for (DayKey day = lastDay - requested + 1; day <= lastDay; ++day) {
+        RollingPoint week = weekly.pointAt(day);
+        RollingPoint month = monthly.pointAt(day);
+        std::cout << std::left << std::setw(12) << DateUtils::formatDayKey(day)
+            << std::right
+            << std::setw(12) << week.dayTotal
+            << std::setw(12) << week.windowSum
+            << std::setw(12) << month.windowSum
+            << std::setw(12) << quarterly.pointAt(day).windowSum
+            << std::setw(12) << month.dailyAverage
+            << "\n";
+    }
+
+    std::cout << std::string(72, '-') << "\n";
+}
+
 void TransactionUI::addNewTransaction() {
     int typeChoice;
     std::cout << "\n1. Add Income\n";
@@ -399,6 +653,12 @@ void TransactionUI::addExpenseTransaction() {
         }
 
     if (transaction) {
+        // An unusual week for the category is worth a mention, not a prompt
+        std::string spikeMessage;
+        if (transactionManager->checkSpendingSpike(transaction, spikeMessage)) {
+            std::cout << "\n" << spikeMessage << "\n";
+        }
+
         transactionManager->addTransaction(transaction);
         transactionManager->saveTransactions();
         std::cout << "Expense transaction added successfully.\n";
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "../include/services/AggregationKernels.h"
+
+namespace {
+    // Random amount/type/category columns, with some repeated extremes
+    struct Columns {
+        std::vector<std::int64_t> amounts;
+        std::vector<TransactionType> types;
+        std::vector<CategoryId> categories;
+    };
+
+    Columns randomColumns(size_t count, unsigned seed) {
+        std::mt19937_64 random(seed);
+        std::uniform_int_distribution<std::int64_t> amount(-5000000, 5000000);
+        std::uniform_int_distribution<int> coin(0, 9);
+        std::uniform_int_distribution<CategoryId> category(0, 5);
+
+        Columns columns;
+        for (size_t row = 0; row < count; ++row) {
+            int pick = coin(random);
+            std::int64_t cents = amount(random);
+            if (pick == 0) {
+                cents = 0;
+            }
+            else if (pick == 1) {
+                cents = 1000000000000;
+            }
+            else if (pick == 2) {
+                cents = -1000000000000;
+            }
+            columns.amounts.push_back(cents);
+            columns.types.push_back(coin(random) < 4 ? TransactionType::INCOME : TransactionType::EXPENSE);
+            columns.categories.push_back(category(random));
+        }
+        return columns;
+    }
+
+    AggregationKernels::Aggregate referenceAggregate(const std::int64_t* amounts, const TransactionType* types,
+        const CategoryId* categories, size_t count, const AggregationKernels::Mask& mask) {
+        AggregationKernels::Aggregate result;
+        for (size_t i = 0; i < count; ++i) {
+            if ((mask.filterType && types[i] != mask.type) ||
+                (mask.filterCategory && categories[i] != mask.categoryId) ||
+                amounts[i] < mask.minCents || amounts[i] > mask.maxCents) {
+                continue;
+            }
+            result.sum += amounts[i];
+            result.count++;
+            result.min = std::min(result.min, amounts[i]);
+            result.max = std::max(result.max, amounts[i]);
+        }
+        return result;
+    }
+
+    std::vector<AggregationKernels::Mask> testMasks() {
+        std::vector<AggregationKernels::Mask> masks(6);
+        masks[1].filterType = true;
+        masks[1].type = TransactionType::INCOME;
+        masks[2].filterCategory = true;
+        masks[2].categoryId = 3;
+        masks[3].minCents = -100000;
+        masks[3].maxCents = 2500000;
+        masks[4].filterType = true;
+        masks[4].type = TransactionType::EXPENSE;
+        masks[4].filterCategory = true;
+        masks[4].categoryId = 1;
+        masks[4].minCents = 0;
+        masks[5].minCents = 10;
+        masks[5].maxCents = -10;    // Empty range
+        return masks;
+    }
+
+    // Instruction sets available on this machine, scalar first
+    std::vector<std::string> availableInstructionSets() {
+        std::vector<std::string> names;
+        for (const char* name : { "scalar", "sse4.2", "avx2" }) {
+            if (AggregationKernels::forceInstructionSet(name)) {
+                names.push_back(name);
+            }
+        }
+        AggregationKernels::forceInstructionSet("");
+        return names;
+    }
+}
+
+class AggregationKernelsTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        // Back to the automatic choice for later tests
+        AggregationKernels::forceInstructionSet("");
+    }
+};
+
+// Test case: Unknown names are refused and leave the choice unchanged
+TEST_F(AggregationKernelsTest, ForceInstructionSet_Unknown) {
+    std::string before = AggregationKernels::activeInstructionSet();
+    EXPECT_FALSE(AggregationKernels::forceInstructionSet("neon"));
+    EXPECT_EQ(before, AggregationKernels::activeInstructionSet());
+
+    ASSERT_TRUE(AggregationKernels::forceInstructionSet("scalar"));
+    EXPECT_STREQ("scalar", AggregationKernels::activeInstructionSet());
+}
+
+// Test case: Every variant matches a plain loop for every mask, at every length
+// (including lengths that leave a tail after the last full vector) and offset
+TEST_F(AggregationKernelsTest, Aggregate_VariantsMatchReference) {
+    const Columns columns = randomColumns(1100, 20240601);
+    const auto masks = testMasks();
+
+    std::vector<size_t> lengths;
+    for (size_t length = 0; length <= 19; ++length) {
+        lengths.push_back(length);
+    }
+    lengths.insert(lengths.end(), { 63, 64, 65, 255, 1021, 1097 });
+
+    for (const std::string& name : availableInstructionSets()) {
+        ASSERT_TRUE(AggregationKernels::forceInstructionSet(name));
+        for (size_t offset = 0; offset < 3; ++offset) {
+            for (size_t length : lengths) {
+                const std::int64_t* amounts = columns.amounts.data() + offset;
+                const TransactionType* types = columns.types.data() + offset;
+                const CategoryId* categories = columns.categories.data() + offset;
+
+                for (size_t maskIndex = 0; maskIndex < masks.size(); ++maskIndex) {
+                    SCOPED_TRACE(name + " offset " + std::to_string(offset) + " length " +
+                        std::to_string(length) + " mask " + std::to_string(maskIndex));
+
+                    auto expected = referenceAggregate(amounts, types, categories, length, masks[maskIndex]);
+                    auto actual = AggregationKernels::aggregate(amounts, types, categories, length, masks[maskIndex]);
+
+                    EXPECT_EQ(expected.sum, actual.sum);
+                    EXPECT_EQ(expected.count, actual.count);
+                    EXPECT_EQ(expected.min, actual.min);
+                    EXPECT_EQ(expected.max, actual.max);
+                }
+            }
+        }
+    }
+}
+
+// Test case: Every variant splits income and expenses like a plain loop
+TEST_F(AggregationKernelsTest, TotalsByType_VariantsMatchReference) {
+    const Columns columns = randomColumns(1100, 7);
+
+    for (const std::string& name : availableInstructionSets()) {
+        ASSERT_TRUE(AggregationKernels::forceInstructionSet(name));
+        for (size_t offset = 0; offset < 3; ++offset) {
+            for (size_t length : { 0, 1, 2, 3, 4, 5, 6, 7, 9, 31, 33, 1000, 1097 }) {
+                SCOPED_TRACE(name + " offset " + std::to_string(offset) + " length " + std::to_string(length));
+                const std::int64_t* amounts = columns.amounts.data() + offset;
+                const TransactionType* types = columns.types.data() + offset;
+
+                AggregationKernels::TypeTotals expected;
+                for (size_t i = 0; i < length; ++i) {
+                    if (types[i] == TransactionType::INCOME) {
+                        expected.incomeCents += amounts[i];
+                        expected.incomeCount++;
+                    }
+                    else {
+                        expected.expenseCents += amounts[i];
+                        expected.expenseCount++;
+                    }
+                    expected.minCents = std::min(expected.minCents, amounts[i]);
+                    expected.maxCents = std::max(expected.maxCents, amounts[i]);
+                }
+
+                auto actual = AggregationKernels::totalsByType(amounts, types, length);
+                EXPECT_EQ(expected.incomeCents, actual.incomeCents);
+                EXPECT_EQ(expected.expenseCents, actual.expenseCents);
+                EXPECT_EQ(expected.incomeCount, actual.incomeCount);
+                EXPECT_EQ(expected.expenseCount, actual.expenseCount);
+                EXPECT_EQ(expected.minCents, actual.minCents);
+                EXPECT_EQ(expected.maxCents, actual.maxCents);
+            }
+        }
+    }
+}
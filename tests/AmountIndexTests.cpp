@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include "../include/services/AmountIndex.h"
+#include "../include/utils/DateUtils.h"
+
+namespace {
+    // The permutation a full stable sort by amount gives
+    std::vector<TransactionStore::RowIndex> sortedByAmount(const TransactionStore& store) {
+        std::vector<TransactionStore::RowIndex> rows(store.size());
+        std::iota(rows.begin(), rows.end(), TransactionStore::RowIndex(0));
+        const auto& amounts = store.amountCents();
+        std::stable_sort(rows.begin(), rows.end(), [&amounts](TransactionStore::RowIndex a, TransactionStore::RowIndex b) {
+            return amounts[a] < amounts[b];
+        });
+        return rows;
+    }
+
+    // Middle inserts go after equal amounts whatever their row, so only the amount order is fixed
+    void expectSortedPermutation(const TransactionStore& store, const AmountIndex& index) {
+        std::vector<TransactionStore::RowIndex> rows = index.rows();
+        const auto& amounts = store.amountCents();
+        EXPECT_TRUE(std::is_sorted(rows.begin(), rows.end(), [&amounts](TransactionStore::RowIndex a, TransactionStore::RowIndex b) {
+            return amounts[a] < amounts[b];
+        }));
+        std::sort(rows.begin(), rows.end());
+        std::vector<TransactionStore::RowIndex> all(store.size());
+        std::iota(all.begin(), all.end(), TransactionStore::RowIndex(0));
+        EXPECT_EQ(all, rows);
+    }
+}
+
+// Test case: Single-row appends and small and bulk batches match a stable full sort
+TEST(AmountIndexTest, Appends_MatchFullSort) {
+    TransactionStore store;
+    AmountIndex index;
+    std::mt19937 random(19);
+    std::uniform_int_distribution<int> tier(1, 20);
+
+    DayKey day = DateUtils::daysFromCivil(2023, 1, 1);
+    for (size_t batch : { 1, 1, 3, 50, 1, 8, 9, 200, 2, 1 }) {
+        SCOPED_TRACE("batch " + std::to_string(batch));
+        size_t firstRow = store.size();
+        for (size_t row = 0; row < batch; ++row) {
+            // Few distinct amounts, so most rows tie with existing ones
+            store.insert(Transaction(Money::fromCents(tier(random) * 100), DateUtils::timeFromDayKey(day++), "Misc",
+                TransactionType::EXPENSE));
+        }
+        index.onAppend(store, firstRow);
+        ASSERT_EQ(sortedByAmount(store), index.rows());
+    }
+
+    AmountIndex rebuilt;
+    rebuilt.rebuild(store);
+    EXPECT_EQ(index.rows(), rebuilt.rows());
+}
+
+// Test case: Appends mixed with middle inserts keep the rows ordered by amount
+TEST(AmountIndexTest, AppendsAndInserts_StaySorted) {
+    TransactionStore store;
+    AmountIndex index;
+    std::mt19937 random(23);
+    std::uniform_int_distribution<int> tier(1, 20);
+    std::uniform_int_distribution<int> earlier(2, 30);
+
+    DayKey day = DateUtils::daysFromCivil(2023, 1, 1);
+    auto transactionOn = [&](DayKey on) {
+        // Few distinct amounts, so most rows tie with existing ones
+        return Transaction(Money::fromCents(tier(random) * 100), DateUtils::timeFromDayKey(on), "Misc",
+            TransactionType::EXPENSE);
+    };
+
+    for (size_t batch : { 1, 1, 3, 50, 1, 8, 9, 200, 2, 1 }) {
+        SCOPED_TRACE("batch " + std::to_string(batch));
+        size_t firstRow = store.size();
+        for (size_t row = 0; row < batch; ++row) {
+            store.insert(transactionOn(day++));
+        }
+        index.onAppend(store, firstRow);
+        expectSortedPermutation(store, index);
+
+        // An out-of-order row lands in the middle
+        size_t row = store.insert(transactionOn(day - earlier(random)));
+        ASSERT_LT(row + 1, store.size());
+        index.onInsert(store, row);
+        expectSortedPermutation(store, index);
+    }
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/models/CategoryDictionary.h"
+#include "../include/models/Transaction.h"
+
+// Test case: Names are copied out, so a later rename does not change them
+TEST(CategoryDictionaryTest, GetName_ReturnsSnapshot) {
+    CategoryDictionary& dictionary = CategoryDictionary::instance();
+    CategoryId id = dictionary.intern("DictionarySnapshotBefore");
+
+    std::string name = dictionary.getName(id);
+    ASSERT_TRUE(dictionary.rename(id, "DictionarySnapshotAfter"));
+
+    EXPECT_EQ("DictionarySnapshotBefore", name);
+    EXPECT_EQ("DictionarySnapshotAfter", dictionary.getName(id));
+
+    // Holders of the id see the new name
+    Transaction transaction(Money::fromCents(100), 0, id, TransactionType::EXPENSE);
+    EXPECT_EQ("DictionarySnapshotAfter", transaction.getCategory());
+
+    CategoryId found = 0;
+    EXPECT_FALSE(dictionary.find("DictionarySnapshotBefore", found));
+    ASSERT_TRUE(dictionary.find("DictionarySnapshotAfter", found));
+    EXPECT_EQ(id, found);
+}
+
+// Test case: Readers racing a renamer always see one whole name or the other
+TEST(CategoryDictionaryTest, GetName_ConcurrentWithRename) {
+    CategoryDictionary& dictionary = CategoryDictionary::instance();
+    const std::string first = "DictionaryRaceFirst";
+    const std::string second = "DictionaryRaceSecond-with-a-longer-name";
+    CategoryId id = dictionary.intern(first);
+
+    std::atomic<bool> stop{ false };
+    std::atomic<size_t> torn{ 0 };
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 4; ++reader) {
+        readers.emplace_back([&]() {
+            while (!stop.load()) {
+                std::string name = dictionary.getName(id);
+                if (name != first && name != second) {
+                    torn++;
+                }
+            }
+        });
+    }
+
+    for (int round = 0; round < 2000; ++round) {
+        dictionary.rename(id, (round % 2 == 0) ? second : first);
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(0u, torn.load());
+    EXPECT_EQ(first, dictionary.getName(id));
+}
+
+// Test case: Unknown ids are reported, not read out of bounds
+TEST(CategoryDictionaryTest, GetName_UnknownId) {
+    EXPECT_THROW(CategoryDictionary::instance().getName(static_cast<CategoryId>(-1)), std::out_of_range);
+}
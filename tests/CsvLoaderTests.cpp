@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <vector>
+#include "../include/utils/FileUtils.h"
+#include "TestSupport.h"
+
+namespace {
+    const std::string VALID_LINE = "12.34,2023-05-06,Food,EXPENSE\n";
+    const size_t MIN_PAD_LINE = 26;   // "1.00,2023-05-06,X,EXPENSE\n"
+
+    // Appends a valid line of exactly the given length (at least MIN_PAD_LINE)
+    void appendPadLine(std::string& text, size_t length) {
+        text += "1.00,2023-05-06," + std::string(length - (MIN_PAD_LINE - 1), 'P') + ",EXPENSE\n";
+    }
+
+    // Fills with valid lines until the text is exactly the given size
+    void fillTo(std::string& text, size_t size) {
+        while (size - text.size() >= VALID_LINE.size() + MIN_PAD_LINE) {
+            text += VALID_LINE;
+        }
+        if (text.size() < size) {
+            appendPadLine(text, size - text.size());
+        }
+    }
+
+    // What sits at a chunk boundary
+    enum class Boundary { EmptyLine, CarriageReturn, CrlfNewline, BadLineStart, InsideBadLine, Count };
+
+    /**
+     * Builds a CSV of exactly the given size in which every listed offset
+     * lands on one of the awkward spots, in turn
+     */
+    std::string buildCsv(size_t size, const std::set<size_t>& offsets) {
+        const std::string crlfLine = "-7.50,2023-06-07,Travel,INCOME\r\n";
+        std::string text;
+        size_t kind = 0;
+        for (size_t offset : offsets) {
+            switch (static_cast<Boundary>(kind++ % static_cast<size_t>(Boundary::Count))) {
+            case Boundary::EmptyLine:
+                fillTo(text, offset);
+                text += "\n";
+                break;
+            case Boundary::CarriageReturn:
+                fillTo(text, offset - (crlfLine.size() - 2));
+                text += crlfLine;
+                break;
+            case Boundary::CrlfNewline:
+                fillTo(text, offset - (crlfLine.size() - 1));
+                text += crlfLine;
+                break;
+            case Boundary::BadLineStart:
+                fillTo(text, offset);
+                text += "oops,not,a\n";
+                break;
+            default:
+                fillTo(text, offset - 3);
+                text += "bad-amount,2023-01-01,Food,EXPENSE\n";
+                break;
+            }
+        }
+        fillTo(text, size);
+        return text;
+    }
+
+    void expectSameRows(const FileUtils::LoadResult& expected, const FileUtils::LoadResult& actual) {
+        ASSERT_EQ(expected.transactions.size(), actual.transactions.size());
+        for (size_t index = 0; index < expected.transactions.size(); ++index) {
+            const Transaction& want = *expected.transactions[index];
+            const Transaction& got = *actual.transactions[index];
+            ASSERT_EQ(want.getAmount(), got.getAmount()) << "row " << index;
+            ASSERT_EQ(want.getDate(), got.getDate()) << "row " << index;
+            ASSERT_EQ(want.getCategoryId(), got.getCategoryId()) << "row " << index;
+            ASSERT_EQ(want.getType(), got.getType()) << "row " << index;
+        }
+        EXPECT_EQ(expected.errors, actual.errors);
+        EXPECT_EQ(expected.failedLines, actual.failedLines);
+        EXPECT_EQ(expected.totalLines, actual.totalLines);
+    }
+}
+
+// Test case: The parallel loader matches the serial one whatever the worker count,
+// with chunk boundaries on empty lines, CRLF line ends and bad lines
+TEST(CsvLoaderTest, ParallelMatchesSerial) {
+    ScopedWorkingDirectory directory;
+    const std::vector<size_t> workerCounts = { 1, 2, 3, 7, 16 };
+    const size_t size = 16 * FileUtils::PARSE_CHUNK_BYTES + 12345;
+
+    // Every offset the aggregator splits at for these worker counts
+    std::set<size_t> offsets;
+    for (size_t workers : workerCounts) {
+        size_t chunks = std::min(size / FileUtils::PARSE_CHUNK_BYTES, workers);
+        for (size_t chunk = 1; chunk < chunks; ++chunk) {
+            offsets.insert(size * chunk / chunks);
+        }
+    }
+    std::string text = buildCsv(size, offsets);
+    ASSERT_EQ(size, text.size());
+    for (size_t offset : offsets) {
+        ASSERT_TRUE(text[offset] == '\n' || text[offset] == '\r' || text[offset - 1] == '\r' ||
+            text.compare(offset, 4, "oops") == 0 || text.compare(offset - 3, 3, "bad") == 0) << "offset " << offset;
+    }
+    std::string path = directory.writeFile("large.csv", text);
+
+    FileUtils::LoadResult serial = FileUtils::loadTransactionsFromCSV(path);
+    ASSERT_FALSE(serial.transactions.empty());
+    size_t badLines = 0;
+    for (size_t kind = 0; kind < offsets.size(); ++kind) {
+        Boundary boundary = static_cast<Boundary>(kind % static_cast<size_t>(Boundary::Count));
+        badLines += (boundary == Boundary::BadLineStart || boundary == Boundary::InsideBadLine) ? 1 : 0;
+    }
+    EXPECT_EQ(badLines, serial.errors.size());
+    EXPECT_EQ("oops,not,a", serial.failedLines.front().second);
+
+    for (size_t workers : workerCounts) {
+        SCOPED_TRACE("workers " + std::to_string(workers));
+        expectSameRows(serial, FileUtils::loadTransactionsFromCSV(path, ParallelAggregator(workers)));
+    }
+}
+
+// Test case: Files below the chunk minimum parse inline with the same result
+TEST(CsvLoaderTest, ParallelSmallFile) {
+    ScopedWorkingDirectory directory;
+    std::string path = directory.writeFile("small.csv", VALID_LINE + "\r\n" + "x,y\n" + VALID_LINE);
+
+    FileUtils::LoadResult serial = FileUtils::loadTransactionsFromCSV(path);
+    EXPECT_EQ(2u, serial.transactions.size());
+    EXPECT_EQ(4, serial.totalLines);
+    ASSERT_EQ(1u, serial.errors.size());
+    EXPECT_EQ(3, serial.errors.front().first);
+    expectSameRows(serial, FileUtils::loadTransactionsFromCSV(path, ParallelAggregator(16)));
+}
+
+// Test case: Streaming a file larger than the read buffer gives the serial loader's rows
+// and errors, in full batches but the last, with a bad line across the first buffer boundary
+TEST(CsvLoaderTest, StreamMatchesSerial) {
+    ScopedWorkingDirectory directory;
+    const size_t boundary = FileUtils::STREAM_BUFFER_SIZE;
+    const size_t size = 2 * FileUtils::STREAM_BUFFER_SIZE + FileUtils::STREAM_BUFFER_SIZE / 2 + 77;
+
+    // One of each awkward line before the boundary, the bad line straddling it, then an empty line
+    std::set<size_t> offsets = { boundary - 4000, boundary - 3000, boundary - 2000, boundary - 1000, boundary,
+        boundary + 5000 };
+    std::string text = buildCsv(size, offsets);
+    ASSERT_EQ(size, text.size());
+    ASSERT_EQ("bad", text.substr(boundary - 3, 3));
+    std::string path = directory.writeFile("stream.csv", text);
+
+    FileUtils::LoadResult serial = FileUtils::loadTransactionsFromCSV(path);
+    ASSERT_EQ(2u, serial.errors.size());
+
+    for (size_t batchSize : { size_t(997), FileUtils::DEFAULT_STREAM_BATCH }) {
+        SCOPED_TRACE("batch " + std::to_string(batchSize));
+        ASSERT_NE(0u, serial.transactions.size() % batchSize);
+
+        std::vector<size_t> batchSizes;
+        std::vector<Transaction> streamed;
+        FileUtils::LoadResult result = FileUtils::streamTransactionsFromCSV(path, batchSize,
+            [&](const std::vector<Transaction>& batch) {
+                batchSizes.push_back(batch.size());
+                streamed.insert(streamed.end(), batch.begin(), batch.end());
+            });
+
+        // Every batch is full except the last
+        ASSERT_EQ((serial.transactions.size() + batchSize - 1) / batchSize, batchSizes.size());
+        for (size_t index = 0; index + 1 < batchSizes.size(); ++index) {
+            ASSERT_EQ(batchSize, batchSizes[index]) << "batch " << index;
+        }
+        EXPECT_EQ(serial.transactions.size() % batchSize, batchSizes.back());
+
+        FileUtils::LoadResult streamedResult = result;
+        for (const Transaction& row : streamed) {
+            streamedResult.transactions.push_back(std::make_shared<Transaction>(row));
+        }
+        expectSameRows(serial, streamedResult);
+    }
+
+    // The error callback sees the same lines, in order
+    std::vector<std::pair<int, std::string>> failedLines;
+    FileUtils::streamTransactionsFromCSV(path, 500, [](const std::vector<Transaction>&) {},
+        [&](int lineNumber, const std::string&, const std::string& lineText) {
+            failedLines.push_back({ lineNumber, lineText });
+        });
+    EXPECT_EQ(serial.failedLines, failedLines);
+}
+
+// Test case: A read failure is reported, not taken for the end of the file
+TEST(CsvLoaderTest, StreamReportsReadError) {
+    ScopedWorkingDirectory directory;
+
+    // A directory opens as a stream but every read of it fails
+    size_t batches = 0;
+    FileUtils::LoadResult result = FileUtils::streamTransactionsFromCSV(directory.path().string(), 100,
+        [&](const std::vector<Transaction>&) { ++batches; });
+
+    EXPECT_EQ(0u, batches);
+    ASSERT_EQ(1u, result.errors.size());
+    EXPECT_EQ(0, result.errors.front().first);
+    EXPECT_EQ("Read error in " + directory.path().string(), result.errors.front().second);
+}
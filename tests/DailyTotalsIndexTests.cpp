@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <utility>
+#include "../include/services/DailyTotalsIndex.h"
+#include "../include/services/TransactionManager.h"
+#include "../include/utils/DateUtils.h"
+#include "TestSupport.h"
+
+namespace {
+    // Brute-force per-day totals to check the index against
+    using Reference = std::map<DayKey, std::pair<std::int64_t, std::int64_t>>;
+
+    std::int64_t referenceSum(const Reference& reference, DayKey firstDay, DayKey lastDay, TransactionType type) {
+        std::int64_t total = 0;
+        for (const auto& [day, totals] : reference) {
+            if (day >= firstDay && day <= lastDay) {
+                total += (type == TransactionType::INCOME) ? totals.first : totals.second;
+            }
+        }
+        return total;
+    }
+
+    // Compares every range between (and just outside) a sample of the recorded days
+    void expectMatchesReference(const DailyTotalsIndex& index, const Reference& reference) {
+        const size_t stride = std::max<size_t>(1, reference.size() / 40);
+        std::vector<DayKey> probes;
+        size_t position = 0;
+        for (const auto& entry : reference) {
+            if (position++ % stride != 0 && position != reference.size()) {
+                continue;
+            }
+            probes.push_back(entry.first - 1);
+            probes.push_back(entry.first);
+            probes.push_back(entry.first + 1);
+        }
+
+        for (DayKey firstDay : probes) {
+            for (DayKey lastDay : probes) {
+                for (TransactionType type : { TransactionType::INCOME, TransactionType::EXPENSE }) {
+                    ASSERT_EQ(referenceSum(reference, firstDay, lastDay, type), index.sumRange(firstDay, lastDay, type))
+                        << "range " << firstDay << ".." << lastDay;
+                }
+            }
+        }
+    }
+}
+
+// Test case: An empty index sums to zero
+TEST(DailyTotalsIndexTest, SumRange_Empty) {
+    DailyTotalsIndex index;
+    EXPECT_EQ(0, index.sumRange(-100000, 100000, TransactionType::EXPENSE));
+    EXPECT_EQ(0u, index.dayCount());
+}
+
+// Test case: Appends, middle inserts and a widening span all match a brute-force sum
+TEST(DailyTotalsIndexTest, SumRange_MatchesBruteForce) {
+    DailyTotalsIndex index;
+    Reference reference;
+    std::mt19937 random(17);
+    std::uniform_int_distribution<int> offset(0, 400);
+    std::uniform_int_distribution<std::int64_t> cents(-5000, 90000);
+    std::uniform_int_distribution<int> coin(0, 1);
+
+    const DayKey base = DateUtils::daysFromCivil(2023, 1, 1);
+    auto record = [&](DayKey day) {
+        TransactionType type = coin(random) ? TransactionType::INCOME : TransactionType::EXPENSE;
+        std::int64_t amount = cents(random);
+        index.add(day, type, amount);
+        auto& totals = reference[day];
+        (type == TransactionType::INCOME ? totals.first : totals.second) += amount;
+    };
+
+    // Days in increasing order (the common append path)
+    for (DayKey day = base; day < base + 40; day += 3) {
+        record(day);
+    }
+    expectMatchesReference(index, reference);
+
+    // New days in the middle and repeats of existing days
+    for (int step = 0; step < 60; ++step) {
+        record(base + offset(random) % 40);
+    }
+    expectMatchesReference(index, reference);
+
+    // The span grows at both ends, far beyond it
+    record(base + 5000);
+    record(base - 3000);
+    record(base + 401);
+    for (int step = 0; step < 40; ++step) {
+        record(base + offset(random));
+    }
+    expectMatchesReference(index, reference);
+
+    EXPECT_EQ(reference.size(), index.dayCount());
+}
+
+// Test case: rebuild from a store matches the incremental path
+TEST(DailyTotalsIndexTest, Rebuild_MatchesIncremental) {
+    TransactionStore store;
+    DailyTotalsIndex incremental;
+    Reference reference;
+    std::mt19937 random(3);
+    std::uniform_int_distribution<int> offset(-200, 200);
+    std::uniform_int_distribution<std::int64_t> cents(1, 100000);
+
+    const DayKey base = DateUtils::daysFromCivil(2024, 6, 1);
+    for (int step = 0; step < 300; ++step) {
+        DayKey day = base + offset(random);
+        TransactionType type = (step % 3 == 0) ? TransactionType::INCOME : TransactionType::EXPENSE;
+        std::int64_t amount = cents(random);
+        store.insert(Transaction(Money::fromCents(amount), DateUtils::timeFromDayKey(day), "Misc", type));
+        incremental.add(day, type, amount);
+        auto& totals = reference[day];
+        (type == TransactionType::INCOME ? totals.first : totals.second) += amount;
+    }
+
+    DailyTotalsIndex rebuilt;
+    rebuilt.rebuild(store);
+    expectMatchesReference(rebuilt, reference);
+    expectMatchesReference(incremental, reference);
+    EXPECT_EQ(reference.size(), rebuilt.dayCount());
+}
+
+// Test case: One mistyped year costs a single slot, not centuries of empty days
+TEST(DailyTotalsIndexTest, OutlierDate_StaysSparse) {
+    TransactionStore store;
+    const DayKey typo = DateUtils::daysFromCivil(202, 1, 1);
+    const DayKey base = DateUtils::daysFromCivil(2023, 1, 1);
+    store.insert(Transaction(Money::fromCents(700), DateUtils::timeFromDayKey(typo), "Misc", TransactionType::EXPENSE));
+    for (DayKey day = base; day < base + 30; ++day) {
+        store.insert(Transaction(Money::fromCents(100), DateUtils::timeFromDayKey(day), "Misc", TransactionType::EXPENSE));
+    }
+
+    DailyTotalsIndex index;
+    index.rebuild(store);
+    EXPECT_EQ(31u, index.dayCount());
+    EXPECT_EQ(700, index.sumRange(typo, typo, TransactionType::EXPENSE));
+    EXPECT_EQ(3700, index.sumRange(typo, base + 29, TransactionType::EXPENSE));
+    EXPECT_EQ(1000, index.sumRange(base + 20, base + 100, TransactionType::EXPENSE));
+
+    // Adding another far-off day keeps the count to the distinct days
+    index.add(DateUtils::daysFromCivil(9999, 12, 31), TransactionType::INCOME, 5);
+    EXPECT_EQ(32u, index.dayCount());
+    EXPECT_EQ(5, index.sumRange(typo, DateUtils::daysFromCivil(9999, 12, 31), TransactionType::INCOME));
+}
+
+// Test case: TransactionManager::sumRange follows out-of-order additions
+TEST(DailyTotalsIndexTest, ManagerSumRange_AfterMiddleInsert) {
+    ScopedWorkingDirectory directory;
+    TransactionManager manager;
+
+    auto at = [](int year, int month, int day) {
+        return DateUtils::timeFromDayKey(DateUtils::daysFromCivil(year, month, day));
+    };
+    manager.addTransaction(std::make_shared<Transaction>(Money::fromCents(1000), at(2023, 1, 10), "Food", TransactionType::EXPENSE));
+    manager.addTransaction(std::make_shared<Transaction>(Money::fromCents(2000), at(2023, 3, 10), "Food", TransactionType::EXPENSE));
+    manager.addTransaction(std::make_shared<Transaction>(Money::fromCents(400), at(2023, 2, 10), "Food", TransactionType::EXPENSE));
+    manager.addTransaction(std::make_shared<Transaction>(Money::fromCents(9000), at(2023, 2, 1), "Pay", TransactionType::INCOME));
+
+    EXPECT_EQ(Money::fromCents(3400), manager.sumRange(at(2023, 1, 1), at(2023, 12, 31), TransactionType::EXPENSE));
+    EXPECT_EQ(Money::fromCents(400), manager.sumRange(at(2023, 2, 1), at(2023, 2, 28), TransactionType::EXPENSE));
+    EXPECT_EQ(Money::fromCents(9000), manager.sumRange(at(2023, 2, 1), at(2023, 2, 1), TransactionType::INCOME));
+    EXPECT_EQ(Money(), manager.sumRange(at(2023, 4, 1), at(2023, 1, 1), TransactionType::EXPENSE));
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+#include "../include/models/Money.h"
+#include "../include/utils/FileUtils.h"
+#include "TestSupport.h"
+
+// Test case: Plain amounts are read exactly
+TEST(MoneyTest, Parse_PlainAmounts) {
+    Money amount;
+
+    ASSERT_TRUE(Money::parse("12", amount));
+    EXPECT_EQ(1200, amount.getCents());
+
+    ASSERT_TRUE(Money::parse("-3.5", amount));
+    EXPECT_EQ(-350, amount.getCents());
+
+    ASSERT_TRUE(Money::parse("+1234.56", amount));
+    EXPECT_EQ(123456, amount.getCents());
+
+    ASSERT_TRUE(Money::parse(".07", amount));
+    EXPECT_EQ(7, amount.getCents());
+}
+
+// Test case: Exponents and extra decimals round to the nearest cent
+TEST(MoneyTest, Parse_FloatingPointFallback) {
+    Money amount;
+
+    ASSERT_TRUE(Money::parse("1.005e2", amount));
+    EXPECT_EQ(10050, amount.getCents());
+
+    ASSERT_TRUE(Money::parse("2.499", amount));
+    EXPECT_EQ(250, amount.getCents());
+
+    ASSERT_TRUE(Money::parse("1e16", amount));
+    EXPECT_EQ(1000000000000000000, amount.getCents());
+}
+
+// Test case: Malformed text is rejected
+TEST(MoneyTest, Parse_RejectsMalformed) {
+    Money amount;
+
+    EXPECT_FALSE(Money::parse("", amount));
+    EXPECT_FALSE(Money::parse("-", amount));
+    EXPECT_FALSE(Money::parse(".", amount));
+    EXPECT_FALSE(Money::parse("12abc", amount));
+    EXPECT_FALSE(Money::parse("inf", amount));
+    EXPECT_FALSE(Money::parse("nan", amount));
+    EXPECT_FALSE(Money::parse("+-5", amount));
+}
+
+// Test case: Amounts whose cents do not fit in 64 bits are rejected
+TEST(MoneyTest, Parse_RejectsOutOfRange) {
+    Money amount = Money::fromCents(42);
+
+    EXPECT_FALSE(Money::parse("1e18", amount));
+    EXPECT_FALSE(Money::parse("-1e18", amount));
+    EXPECT_FALSE(Money::parse("1e300", amount));
+    EXPECT_FALSE(Money::parse("1e400", amount));
+    EXPECT_FALSE(Money::parse("12345678901234567890", amount));
+    EXPECT_FALSE(Money::parse("-12345678901234567890.5", amount));
+    EXPECT_FALSE(Money::parse("92233720368547758.08", amount));
+
+    // A failed parse leaves the output untouched
+    EXPECT_EQ(42, amount.getCents());
+
+    EXPECT_THROW(Money::fromString("1e300"), std::invalid_argument);
+}
+
+// Test case: Interactive input converts to the nearest cent, or is rejected when out of range
+TEST(MoneyTest, TryFromDouble_Range) {
+    Money amount = Money::fromCents(42);
+
+    ASSERT_TRUE(Money::tryFromDouble(12.345, amount));
+    EXPECT_EQ(1235, amount.getCents());
+    ASSERT_TRUE(Money::tryFromDouble(-0.004, amount));
+    EXPECT_EQ(0, amount.getCents());
+
+    amount = Money::fromCents(42);
+    EXPECT_FALSE(Money::tryFromDouble(1e20, amount));
+    EXPECT_FALSE(Money::tryFromDouble(-1e17, amount));
+    EXPECT_FALSE(Money::tryFromDouble(std::numeric_limits<double>::infinity(), amount));
+    EXPECT_FALSE(Money::tryFromDouble(std::numeric_limits<double>::quiet_NaN(), amount));
+    EXPECT_EQ(42, amount.getCents());
+}
+
+// Test case: Division rounds halves away from zero on both sides
+TEST(MoneyTest, DividedBy_RoundsHalfAwayFromZero) {
+    EXPECT_EQ(2, Money::fromCents(3).dividedBy(2).getCents());
+    EXPECT_EQ(-2, Money::fromCents(-3).dividedBy(2).getCents());
+    EXPECT_EQ(1, Money::fromCents(4).dividedBy(3).getCents());
+    EXPECT_EQ(-1, Money::fromCents(-4).dividedBy(3).getCents());
+    EXPECT_EQ(-3, Money::fromCents(-5).dividedBy(2).getCents());
+    EXPECT_EQ(0, Money().dividedBy(7).getCents());
+}
+
+// Test case: Formatting keeps two decimals and the sign
+TEST(MoneyTest, ToString_Formatting) {
+    EXPECT_EQ("1234.50", Money::fromCents(123450).toString());
+    EXPECT_EQ("-0.75", Money::fromCents(-75).toString());
+    EXPECT_EQ("0.00", Money().toString());
+    EXPECT_EQ("-92233720368547758.08", Money::fromCents(INT64_MIN).toString());
+}
+
+// Test case: The loader reports an out-of-range amount instead of loading it
+TEST(MoneyTest, Loader_RejectsOutOfRangeAmount) {
+    ScopedWorkingDirectory directory;
+    std::string path = directory.writeFile("amounts.csv",
+        "10.00,2023-01-05,Food,EXPENSE\n"
+        "1e300,2023-01-06,Food,EXPENSE\n"
+        "99999999999999999999,2023-01-07,Food,EXPENSE\n"
+        "5.25,2023-01-08,Food,INCOME\n");
+
+    FileUtils::LoadResult result = FileUtils::loadTransactionsFromCSV(path);
+
+    ASSERT_EQ(2u, result.transactions.size());
+    EXPECT_EQ(1000, result.transactions[0]->getAmount().getCents());
+    EXPECT_EQ(525, result.transactions[1]->getAmount().getCents());
+
+    ASSERT_EQ(2u, result.errors.size());
+    EXPECT_EQ(2, result.errors[0].first);
+    EXPECT_NE(std::string::npos, result.errors[0].second.find("Invalid amount"));
+    EXPECT_EQ(3, result.errors[1].first);
+    EXPECT_NE(std::string::npos, result.errors[1].second.find("Invalid amount"));
+}
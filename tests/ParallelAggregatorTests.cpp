@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../include/services/ParallelAggregator.h"
+#include "../include/services/TransactionManager.h"
+#include "../include/utils/DateUtils.h"
+#include "TestSupport.h"
+
+namespace {
+    // The chunks a reduce visited, in merge order
+    using Chunks = std::vector<std::pair<size_t, size_t>>;
+
+    Chunks collectChunks(const ParallelAggregator& aggregator, size_t first, size_t end, size_t minPerChunk) {
+        return aggregator.reduce<Chunks>(first, end, minPerChunk,
+            [](size_t chunkFirst, size_t chunkEnd) {
+                return Chunks{ { chunkFirst, chunkEnd } };
+            },
+            [](Chunks& into, Chunks&& next) {
+                into.insert(into.end(), next.begin(), next.end());
+            });
+    }
+}
+
+// Test case: Chunks cover the range in order, without gaps or overlaps
+TEST(ParallelAggregatorTest, Reduce_ChunksPartitionRange) {
+    for (size_t threads = 1; threads <= 16; ++threads) {
+        SCOPED_TRACE("threads " + std::to_string(threads));
+        ParallelAggregator aggregator(threads);
+
+        Chunks chunks = collectChunks(aggregator, 5, 1005, 1);
+        ASSERT_EQ(threads, chunks.size());
+        EXPECT_EQ(5u, chunks.front().first);
+        EXPECT_EQ(1005u, chunks.back().second);
+        for (size_t chunk = 1; chunk < chunks.size(); ++chunk) {
+            EXPECT_EQ(chunks[chunk - 1].second, chunks[chunk].first);
+            EXPECT_LT(chunks[chunk].first, chunks[chunk].second);
+        }
+    }
+}
+
+// Test case: Small ranges run inline as a single chunk
+TEST(ParallelAggregatorTest, Reduce_SmallRangeRunsInline) {
+    ParallelAggregator aggregator(8);
+
+    Chunks chunks = collectChunks(aggregator, 0, 1000, 600);
+    ASSERT_EQ(1u, chunks.size());
+    EXPECT_EQ(std::make_pair(size_t(0), size_t(1000)), chunks.front());
+
+    // At most one chunk per minPerChunk units
+    EXPECT_EQ(3u, collectChunks(aggregator, 0, 1000, 300).size());
+
+    // The row overload uses MIN_ROWS_PER_CHUNK
+    Chunks rows = aggregator.reduce<Chunks>(0, 2 * ParallelAggregator::MIN_ROWS_PER_CHUNK - 1,
+        [](size_t first, size_t end) { return Chunks{ { first, end } }; },
+        [](Chunks& into, Chunks&& next) { into.insert(into.end(), next.begin(), next.end()); });
+    EXPECT_EQ(1u, rows.size());
+
+    // An empty range is still mapped once
+    EXPECT_EQ(Chunks({ { 7, 7 } }), collectChunks(aggregator, 7, 7, 1));
+}
+
+// Test case: Integer sums are identical for every thread count
+TEST(ParallelAggregatorTest, Reduce_SumIndependentOfThreads) {
+    std::mt19937_64 random(99);
+    std::uniform_int_distribution<std::int64_t> amount(-1000000, 1000000);
+    std::vector<std::int64_t> values(100003);
+    std::int64_t expected = 0;
+    for (auto& value : values) {
+        value = amount(random);
+        expected += value;
+    }
+
+    for (size_t threads = 1; threads <= 12; ++threads) {
+        ParallelAggregator aggregator(threads);
+        std::int64_t total = aggregator.reduce<std::int64_t>(0, values.size(), 1000,
+            [&values](size_t first, size_t end) {
+                std::int64_t partial = 0;
+                for (size_t index = first; index < end; ++index) {
+                    partial += values[index];
+                }
+                return partial;
+            },
+            [](std::int64_t& into, std::int64_t&& next) { into += next; });
+        EXPECT_EQ(expected, total) << "threads " << threads;
+    }
+}
+
+// Test case: An exception thrown by a worker reaches the caller
+TEST(ParallelAggregatorTest, Reduce_RethrowsWorkerException) {
+    ParallelAggregator aggregator(4);
+    EXPECT_THROW(aggregator.reduce<int>(0, 400, 1,
+        [](size_t first, size_t) -> int {
+            if (first == 100) {
+                throw std::runtime_error("chunk failed");
+            }
+            return 0;
+        },
+        [](int&, int&&) {}), std::runtime_error);
+}
+
+// Test case: Ledger totals built across 1..N threads match a single pass
+TEST(ParallelAggregatorTest, LedgerTotals_IndependentOfThreads) {
+    // Enough rows for four chunks of MIN_ROWS_PER_CHUNK
+    const size_t rowCount = 4 * ParallelAggregator::MIN_ROWS_PER_CHUNK + 123;
+    const DayKey firstDay = DateUtils::daysFromCivil(2022, 1, 1);
+    const std::vector<std::string> categories = { "Food", "Rent", "Travel", "Salary", "Gifts" };
+
+    std::mt19937 random(5);
+    std::uniform_int_distribution<std::int64_t> amount(1, 500000);
+    std::uniform_int_distribution<int> pick(0, 4);
+
+    std::vector<std::shared_ptr<Transaction>> batch;
+    batch.reserve(rowCount);
+    Money expectedIncome;
+    Money expectedExpenses;
+    std::map<MonthKey, MonthlyTotals> expectedMonths;
+    for (size_t row = 0; row < rowCount; ++row) {
+        DayKey day = firstDay + static_cast<DayKey>(row % 700);
+        TransactionType type = pick(random) == 3 ? TransactionType::INCOME : TransactionType::EXPENSE;
+        Money cents = Money::fromCents(amount(random));
+        batch.push_back(std::make_shared<Transaction>(cents, DateUtils::timeFromDayKey(day),
+            categories[pick(random)], type));
+
+        auto& month = expectedMonths[DateUtils::monthKeyFromDayKey(day)];
+        (type == TransactionType::INCOME ? expectedIncome : expectedExpenses) += cents;
+        (type == TransactionType::INCOME ? month.income : month.expenses) += cents;
+    }
+
+    CategoryId food = CategoryDictionary::instance().intern("Food");
+    MonthKey march = DateUtils::toMonthKey(2022, 3);
+
+    Money referenceFoodMarch;
+    size_t referenceSketchCount = 0;
+    for (size_t threads = 1; threads <= 4; ++threads) {
+        SCOPED_TRACE("threads " + std::to_string(threads));
+        ScopedWorkingDirectory directory;
+        TransactionManager manager;
+        manager.setAggregationThreads(threads);
+        manager.addTransactions(batch);
+
+        FinancialSummary summary = manager.getFinancialSummary();
+        EXPECT_EQ(rowCount, summary.transactionCount);
+        EXPECT_EQ(expectedIncome, summary.totalIncome);
+        EXPECT_EQ(expectedExpenses, summary.totalExpenses);
+        EXPECT_EQ(summary.incomeCount + summary.expenseCount, summary.transactionCount);
+
+        const auto& months = manager.getMonthlyTotals();
+        ASSERT_EQ(expectedMonths.size(), months.size());
+        for (const auto& [month, totals] : expectedMonths) {
+            auto it = months.find(month);
+            ASSERT_NE(months.end(), it);
+            EXPECT_EQ(totals.income, it->second.income);
+            EXPECT_EQ(totals.expenses, it->second.expenses);
+        }
+
+        Money foodMarch = manager.getCategoryMonthSpend(food, march);
+        size_t sketchCount = manager.getExpenseSketch(food, march).getCount();
+        if (threads == 1) {
+            referenceFoodMarch = foodMarch;
+            referenceSketchCount = sketchCount;
+        }
+        EXPECT_EQ(referenceFoodMarch, foodMarch);
+        EXPECT_EQ(referenceSketchCount, sketchCount);
+
+        // Slice aggregates are split across the same workers at read time
+        EXPECT_EQ(expectedExpenses, manager.query().ofType(TransactionType::EXPENSE).sum());
+        EXPECT_EQ(expectedIncome, manager.query().ofType(TransactionType::INCOME).sum());
+    }
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include "../include/services/QuantileSketch.h"
+
+namespace {
+    // Rank fractions checked in every test
+    const double FRACTIONS[] = { 0.01, 0.05, 0.1, 0.25, 0.5, 0.75, 0.9, 0.95, 0.99 };
+
+    // Documented bound: rank error within about 2.5/k of the count
+    double rankErrorBound(size_t k, size_t count) {
+        return 2.5 / static_cast<double>(k) * static_cast<double>(count);
+    }
+
+    // Distance from the target rank to the ranks the value actually holds in the data
+    double rankError(const std::vector<std::int64_t>& sorted, std::int64_t value, double fraction) {
+        double below = static_cast<double>(std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin());
+        double atOrBelow = static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), value) - sorted.begin());
+        double target = fraction * static_cast<double>(sorted.size());
+        if (target < below) {
+            return below - target;
+        }
+        if (target > atOrBelow) {
+            return target - atOrBelow;
+        }
+        return 0.0;
+    }
+
+    void expectWithinBound(const QuantileSketch& sketch, std::vector<std::int64_t> values, size_t k) {
+        std::sort(values.begin(), values.end());
+        ASSERT_EQ(values.size(), sketch.getCount());
+        EXPECT_EQ(values.front(), sketch.getMin());
+        EXPECT_EQ(values.back(), sketch.getMax());
+
+        for (double fraction : FRACTIONS) {
+            EXPECT_LE(rankError(values, sketch.quantile(fraction), fraction), rankErrorBound(k, values.size()))
+                << "fraction " << fraction;
+        }
+    }
+
+    std::vector<std::int64_t> randomAmounts(size_t count, unsigned seed) {
+        std::mt19937_64 random(seed);
+        std::lognormal_distribution<double> amount(8.0, 1.5);
+        std::vector<std::int64_t> values(count);
+        for (auto& value : values) {
+            value = static_cast<std::int64_t>(amount(random));
+        }
+        return values;
+    }
+}
+
+// Test case: Fewer values than k are kept exactly
+TEST(QuantileSketchTest, SmallGroup_Exact) {
+    QuantileSketch sketch;
+    std::vector<std::int64_t> values;
+    for (std::int64_t value = 1; value <= 100; ++value) {
+        values.push_back(value * 7 % 101);
+        sketch.add(values.back());
+    }
+
+    EXPECT_EQ(100u, sketch.retained());
+    std::sort(values.begin(), values.end());
+    for (double fraction : FRACTIONS) {
+        EXPECT_EQ(0.0, rankError(values, sketch.quantile(fraction), fraction)) << "fraction " << fraction;
+    }
+    EXPECT_EQ(values.front(), sketch.quantile(0.0));
+    EXPECT_EQ(values.back(), sketch.quantile(1.0));
+}
+
+// Test case: An empty sketch answers zero
+TEST(QuantileSketchTest, Empty) {
+    QuantileSketch sketch;
+    EXPECT_TRUE(sketch.empty());
+    EXPECT_EQ(0, sketch.quantile(0.5));
+}
+
+// Test case: Rank error stays within the documented bound for k = 400
+TEST(QuantileSketchTest, RankError_RandomStream) {
+    for (size_t count : { 1000, 25000, 300000 }) {
+        SCOPED_TRACE("count " + std::to_string(count));
+        std::vector<std::int64_t> values = randomAmounts(count, static_cast<unsigned>(count));
+        QuantileSketch sketch(400);
+        for (std::int64_t value : values) {
+            sketch.add(value);
+        }
+        expectWithinBound(sketch, values, 400);
+
+        // Memory stays O(k) however many values are added
+        EXPECT_LT(sketch.retained(), 4u * 400u);
+    }
+}
+
+// Test case: Sorted and reverse-sorted input (worst case for compaction) stay in bound
+TEST(QuantileSketchTest, RankError_SortedStreams) {
+    std::vector<std::int64_t> values(200000);
+    for (size_t index = 0; index < values.size(); ++index) {
+        values[index] = static_cast<std::int64_t>(index);
+    }
+
+    QuantileSketch ascending(400);
+    for (std::int64_t value : values) {
+        ascending.add(value);
+    }
+    expectWithinBound(ascending, values, 400);
+
+    QuantileSketch descending(400);
+    for (auto it = values.rbegin(); it != values.rend(); ++it) {
+        descending.add(*it);
+    }
+    expectWithinBound(descending, values, 400);
+}
+
+// Test case: Many repeated values (typical of fixed bills) stay in bound
+TEST(QuantileSketchTest, RankError_HeavyDuplicates) {
+    std::mt19937 random(11);
+    std::uniform_int_distribution<int> pick(0, 9);
+    std::vector<std::int64_t> values(120000);
+    QuantileSketch sketch(400);
+    for (auto& value : values) {
+        value = 999 + 1000 * pick(random);
+        sketch.add(value);
+    }
+    expectWithinBound(sketch, values, 400);
+}
+
+// Test case: Sketches of partitions merge into one that stays in bound
+TEST(QuantileSketchTest, RankError_MergedPartitions) {
+    std::vector<std::int64_t> values = randomAmounts(240000, 77);
+
+    for (size_t parts : { 2, 7, 64 }) {
+        SCOPED_TRACE("parts " + std::to_string(parts));
+        QuantileSketch merged(400);
+        for (size_t part = 0; part < parts; ++part) {
+            QuantileSketch partial(400);
+            for (size_t index = values.size() * part / parts; index < values.size() * (part + 1) / parts; ++index) {
+                partial.add(values[index]);
+            }
+            merged.merge(partial);
+        }
+        expectWithinBound(merged, values, 400);
+    }
+}
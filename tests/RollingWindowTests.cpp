@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <thread>
+#include "../include/services/RollingWindow.h"
+#include "../include/services/TransactionManager.h"
+#include "../include/models/CategoryDictionary.h"
+#include "../include/utils/DateUtils.h"
+#include "TestSupport.h"
+
+namespace {
+    // Brute-force expense totals per day, optionally for one category
+    using Reference = std::map<DayKey, std::int64_t>;
+
+    Reference referenceOf(const TransactionStore& store, const std::string& category) {
+        Reference reference;
+        for (size_t row = 0; row < store.size(); ++row) {
+            if (!category.empty() && store.categoryIds()[row] != CategoryDictionary::instance().intern(category)) {
+                continue;
+            }
+            reference[store.dayKeys()[row]] += (store.types()[row] == TransactionType::EXPENSE) ? store.amountCents()[row] : 0;
+        }
+        return reference;
+    }
+
+    // Checks every calendar day of the window's range (and a few past it) against a direct sum
+    void expectMatchesReference(const RollingWindow& window, const Reference& reference, DayKey ledgerLastDay) {
+        ASSERT_FALSE(window.empty());
+        EXPECT_EQ(reference.begin()->first, window.firstDay());
+        EXPECT_EQ(ledgerLastDay, window.lastDay());
+
+        const DayKey span = static_cast<DayKey>(window.getWindowDays());
+        for (DayKey day = window.firstDay() - 2; day <= ledgerLastDay + span + 2; ++day) {
+            std::int64_t windowSum = 0;
+            for (auto it = reference.lower_bound(day - span + 1); it != reference.end() && it->first <= day; ++it) {
+                windowSum += it->second;
+            }
+            auto own = reference.find(day);
+
+            RollingPoint point = window.pointAt(day);
+            ASSERT_EQ(day, point.day);
+            ASSERT_EQ(own == reference.end() ? 0 : own->second, point.dayTotal.getCents()) << "day " << day;
+            ASSERT_EQ(windowSum, point.windowSum.getCents()) << "day " << day;
+        }
+    }
+}
+
+// Test case: Appended batches (some on the last day) match a brute-force sum on every day
+TEST(RollingWindowTest, PointAt_MatchesBruteForce) {
+    TransactionStore store;
+    CategoryIndex categoryIndex;
+    std::mt19937 random(5);
+    std::uniform_int_distribution<int> gap(0, 25);
+    std::uniform_int_distribution<std::int64_t> cents(1, 50000);
+    std::uniform_int_distribution<int> pick(0, 3);
+    const std::vector<std::string> categories = { "RollFood", "RollRent", "RollFuel", "RollPay" };
+
+    std::vector<RollingWindow> windows;
+    for (size_t days : { 1, 7, 30, 90 }) {
+        windows.emplace_back(days);
+        windows.emplace_back(days, CategoryDictionary::instance().intern("RollFuel"));
+    }
+
+    DayKey day = DateUtils::daysFromCivil(2023, 1, 1);
+    for (int batch = 0; batch < 30; ++batch) {
+        size_t firstRow = store.size();
+        for (int row = 0; row < 12; ++row) {
+            // Batches start on the previous batch's last day, so sweeps resume mid-day
+            if (row > 0) {
+                day += gap(random) % 4 == 0 ? gap(random) : 0;
+            }
+            TransactionType type = pick(random) == 0 ? TransactionType::INCOME : TransactionType::EXPENSE;
+            store.insert(Transaction(Money::fromCents(cents(random)), DateUtils::timeFromDayKey(day),
+                categories[pick(random)], type));
+        }
+        categoryIndex.onAppend(store, firstRow);
+
+        for (auto& window : windows) {
+            window.update(store, categoryIndex);
+        }
+        if (batch % 10 == 9) {
+            for (const auto& window : windows) {
+                SCOPED_TRACE("batch " + std::to_string(batch) + " window " + std::to_string(window.getWindowDays()));
+                expectMatchesReference(window, referenceOf(store, (&window - windows.data()) % 2 ? "RollFuel" : ""),
+                    store.dayKeys().back());
+            }
+        }
+    }
+
+    // A fresh sweep over the whole ledger gives the same series as the incremental one
+    for (const auto& window : windows) {
+        RollingWindow fresh = window;
+        fresh.reset();
+        fresh.update(store, categoryIndex);
+        ASSERT_EQ(window.points().size(), fresh.points().size());
+        for (size_t index = 0; index < fresh.points().size(); ++index) {
+            EXPECT_EQ(fresh.points()[index].day, window.points()[index].day);
+            EXPECT_EQ(fresh.points()[index].windowSum, window.points()[index].windowSum);
+            EXPECT_EQ(fresh.points()[index].dayTotal, window.points()[index].dayTotal);
+        }
+    }
+}
+
+// Test case: One mistyped year costs a couple of points, not centuries of empty days
+TEST(RollingWindowTest, OutlierDate_StaysSparse) {
+    TransactionStore store;
+    CategoryIndex categoryIndex;
+    const DayKey typo = DateUtils::daysFromCivil(202, 1, 1);
+    const DayKey base = DateUtils::daysFromCivil(2023, 1, 1);
+    store.insert(Transaction(Money::fromCents(700), DateUtils::timeFromDayKey(typo), "Misc", TransactionType::EXPENSE));
+    for (DayKey day = base; day < base + 30; ++day) {
+        store.insert(Transaction(Money::fromCents(100), DateUtils::timeFromDayKey(day), "Misc", TransactionType::EXPENSE));
+    }
+    categoryIndex.rebuild(store);
+
+    RollingWindow window(7);
+    window.update(store, categoryIndex);
+
+    // The typo enters and leaves; then each ledger day (none leave past the last day)
+    EXPECT_EQ(2u + 30u, window.points().size());
+    EXPECT_EQ(typo, window.firstDay());
+    EXPECT_EQ(700, window.pointAt(typo + 6).windowSum.getCents());
+    EXPECT_EQ(0, window.pointAt(typo + 7).windowSum.getCents());
+    EXPECT_EQ(0, window.pointAt(base - 1).windowSum.getCents());
+    EXPECT_EQ(700, window.pointAt(base + 29).windowSum.getCents());
+    EXPECT_EQ(300, window.pointAt(base + 33).windowSum.getCents());
+    expectMatchesReference(window, referenceOf(store, ""), base + 29);
+}
+
+// Test case: A category with no rows has an empty window
+TEST(RollingWindowTest, MissingCategory_Empty) {
+    TransactionStore store;
+    CategoryIndex categoryIndex;
+    store.insert(Transaction(Money::fromCents(100), DateUtils::timeFromDayKey(DateUtils::daysFromCivil(2023, 1, 1)),
+        "Misc", TransactionType::EXPENSE));
+    categoryIndex.rebuild(store);
+
+    RollingWindow window(7, CategoryDictionary::instance().intern("RollNobody"));
+    window.update(store, categoryIndex);
+    EXPECT_TRUE(window.empty());
+    EXPECT_EQ(0, window.pointAt(DateUtils::daysFromCivil(2023, 1, 1)).windowSum.getCents());
+}
+
+// Test case: Concurrent readers of the manager's cached windows get the same series,
+// and a returned window survives later changes to the ledger
+TEST(RollingWindowTest, ManagerRollingSpend_ConcurrentReaders) {
+    ScopedWorkingDirectory directory;
+    TransactionManager manager;
+    const DayKey base = DateUtils::daysFromCivil(2023, 1, 1);
+    std::vector<std::shared_ptr<Transaction>> batch;
+    for (int row = 0; row < 3000; ++row) {
+        batch.push_back(std::make_shared<Transaction>(Money::fromCents(100 + row % 37),
+            DateUtils::timeFromDayKey(base + row / 7), row % 3 ? "RollFood" : "RollFuel", TransactionType::EXPENSE));
+    }
+    manager.addTransactions(batch);
+    const CategoryId fuel = CategoryDictionary::instance().intern("RollFuel");
+
+    // Every reader creates and sweeps the same cache entries at once
+    std::vector<std::vector<RollingWindow>> seen(4);
+    std::vector<std::thread> readers;
+    for (auto& windows : seen) {
+        readers.emplace_back([&manager, &windows, fuel] {
+            for (size_t days : { 7, 30, 90 }) {
+                windows.push_back(manager.getRollingSpend(days));
+                windows.push_back(manager.getRollingSpend(days, fuel));
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    const DayKey lastDay = base + 2999 / 7;
+    for (const auto& windows : seen) {
+        ASSERT_EQ(6u, windows.size());
+        for (size_t index = 0; index < windows.size(); ++index) {
+            SCOPED_TRACE("window " + std::to_string(index));
+            EXPECT_EQ(lastDay, windows[index].lastDay());
+            EXPECT_EQ(seen[0][index].points().size(), windows[index].points().size());
+            EXPECT_EQ(seen[0][index].pointAt(lastDay).windowSum, windows[index].pointAt(lastDay).windowSum);
+        }
+    }
+
+    // A middle insert resets the cache; the copy already handed out is unaffected
+    RollingWindow weekly = manager.getRollingSpend(7);
+    Money before = weekly.pointAt(lastDay).windowSum;
+    manager.addTransaction(std::make_shared<Transaction>(Money::fromCents(5000), DateUtils::timeFromDayKey(lastDay - 2),
+        "RollFood", TransactionType::EXPENSE));
+    EXPECT_EQ(before, weekly.pointAt(lastDay).windowSum);
+    EXPECT_EQ(before + Money::fromCents(5000), manager.getRollingSpend(7).pointAt(lastDay).windowSum);
+}
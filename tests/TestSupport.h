@@ -0,0 +1,57 @@
+#ifndef TEST_SUPPORT_H
+#define TEST_SUPPORT_H
+
+#include <filesystem>
+#include <string>
+#include <fstream>
+#include <atomic>
+#include <chrono>
+
+/**
+ * Runs a test inside a fresh, empty working directory
+ *
+ * TransactionManager loads data/transactions.csv on construction and saves
+ * it on destruction, so every test that creates one gets its own directory
+ * and never sees another test's ledger. The previous directory is restored
+ * and the temporary one removed on destruction.
+ */
+class ScopedWorkingDirectory {
+private:
+    std::filesystem::path previous;
+    std::filesystem::path directory;
+
+public:
+    ScopedWorkingDirectory() : previous(std::filesystem::current_path()) {
+        static std::atomic<unsigned> sequence{ 0 };
+        auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        directory = std::filesystem::temp_directory_path() /
+            ("budget-tests-" + std::to_string(stamp) + "-" + std::to_string(sequence++));
+        std::filesystem::create_directories(directory);
+        std::filesystem::current_path(directory);
+    }
+
+    ~ScopedWorkingDirectory() {
+        std::error_code ignored;
+        std::filesystem::current_path(previous, ignored);
+        std::filesystem::remove_all(directory, ignored);
+    }
+
+    ScopedWorkingDirectory(const ScopedWorkingDirectory&) = delete;
+    ScopedWorkingDirectory& operator=(const ScopedWorkingDirectory&) = delete;
+
+    const std::filesystem::path& path() const { return directory; }
+
+    /**
+     * Writes a file (binary, so line endings are kept as given)
+     *
+     * @return The file's full path
+     */
+    std::string writeFile(const std::string& name, const std::string& contents) const {
+        std::filesystem::path filePath = directory / name;
+        std::ofstream file(filePath, std::ios::binary);
+        file << contents;
+        return filePath.string();
+    }
+};
+
+#endif // TEST_SUPPORT_H
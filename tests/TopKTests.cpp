@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/services/TransactionManager.h"
+#include "../include/utils/DateUtils.h"
+#include "TestSupport.h"
+
+// Test fixture with a ledger full of tied amounts
+class TopKTest : public ::testing::Test {
+protected:
+    ScopedWorkingDirectory workingDirectory;
+    std::unique_ptr<TransactionManager> manager;
+    MonthKey march = DateUtils::toMonthKey(2023, 3);
+
+    void SetUp() override {
+        manager = std::make_unique<TransactionManager>();
+
+        std::mt19937 random(41);
+        std::uniform_int_distribution<int> tier(1, 12);
+        std::uniform_int_distribution<int> dayOffset(0, 240);
+        std::uniform_int_distribution<int> pick(0, 3);
+        const std::vector<std::string> categories = { "TopKFood", "TopKRent", "TopKTravel", "TopKGifts" };
+        const DayKey firstDay = DateUtils::daysFromCivil(2023, 1, 1);
+
+        std::vector<std::shared_ptr<Transaction>> batch;
+        for (int row = 0; row < 4000; ++row) {
+            // Few distinct amounts, so almost every cut-off falls inside a tie
+            Money amount = Money::fromCents(tier(random) * 2500);
+            DayKey day = firstDay + dayOffset(random);
+            TransactionType type = pick(random) == 0 ? TransactionType::INCOME : TransactionType::EXPENSE;
+            batch.push_back(std::make_shared<Transaction>(amount, DateUtils::timeFromDayKey(day),
+                categories[pick(random)], type));
+        }
+        manager->addTransactions(batch);
+    }
+
+    void TearDown() override {
+        manager.reset();
+    }
+
+    // Full sort of the query's rows: largest amount first, newer row first among ties
+    static std::vector<size_t> fullSort(const TransactionQuery& query, size_t k) {
+        std::vector<std::pair<std::int64_t, size_t>> rows;
+        for (const TransactionRef row : query.view()) {
+            rows.emplace_back(row.getAmount().getCents(), row.getRow());
+        }
+        std::sort(rows.begin(), rows.end(), std::greater<>());
+        rows.resize(std::min(rows.size(), k));
+
+        std::vector<size_t> order;
+        for (const auto& row : rows) {
+            order.push_back(row.second);
+        }
+        return order;
+    }
+
+    static std::vector<size_t> rowsOf(const TransactionView& view) {
+        std::vector<size_t> order;
+        for (const TransactionRef row : view) {
+            order.push_back(row.getRow());
+        }
+        return order;
+    }
+
+    // Checks a query's topK on both paths against the full sort
+    void expectTopKMatches(const TransactionQuery& query, const std::string& label) {
+        for (size_t k : { 1, 2, 7, 50, 333, 5000 }) {
+            SCOPED_TRACE(label + " k " + std::to_string(k));
+            std::vector<size_t> expected = fullSort(query, k);
+
+            // Unwindowed: the amount-index walk when its estimated cost is lower
+            EXPECT_EQ(expected, rowsOf(query.topK(k)));
+
+            // A limit that keeps every row forces the bounded heap over the same rows
+            TransactionQuery windowed = query;
+            windowed.limit(std::numeric_limits<size_t>::max() - 1);
+            EXPECT_EQ(expected, rowsOf(windowed.topK(k)));
+
+            // The manager entry point is the same query
+            EXPECT_EQ(expected, rowsOf(manager->topK(k, query)));
+        }
+    }
+};
+
+// Test case: Unfiltered ledger
+TEST_F(TopKTest, AllRows) {
+    expectTopKMatches(manager->query(), "all");
+}
+
+// Test case: Type, category, month and amount filters, alone and together
+TEST_F(TopKTest, FilteredQueries) {
+    expectTopKMatches(manager->query().ofType(TransactionType::EXPENSE), "expenses");
+    expectTopKMatches(manager->query().inCategory("TopKTravel"), "category");
+    expectTopKMatches(manager->query().inMonth(march), "month");
+    expectTopKMatches(manager->query().amountBetween(Money::fromCents(5000), Money::fromCents(20000)), "amount");
+    expectTopKMatches(manager->query().ofType(TransactionType::INCOME).inCategory("TopKRent").inMonth(march)
+        .amountBetween(Money::fromCents(10000), Money::fromCents(30000)), "combined");
+}
+
+// Test case: Queries with no matching rows, and k = 0
+TEST_F(TopKTest, EmptyResults) {
+    EXPECT_TRUE(manager->query().inCategory("TopKNoSuchCategory").topK(5).empty());
+    EXPECT_TRUE(manager->query().amountBetween(Money::fromCents(1), Money::fromCents(2)).topK(5).empty());
+    EXPECT_TRUE(manager->query().topK(0).empty());
+}
+
+// Test case: With an offset, only the rows in the window are ranked
+TEST_F(TopKTest, WindowedQuery) {
+    TransactionQuery query = manager->query().ofType(TransactionType::EXPENSE).offset(100).limit(400);
+
+    // The window's rows, ranked by a full sort
+    std::vector<std::pair<std::int64_t, size_t>> rows;
+    for (const TransactionRef row : query.view()) {
+        rows.emplace_back(row.getAmount().getCents(), row.getRow());
+    }
+    ASSERT_EQ(400u, rows.size());
+    std::sort(rows.begin(), rows.end(), std::greater<>());
+
+    std::vector<size_t> expected;
+    for (size_t index = 0; index < 25; ++index) {
+        expected.push_back(rows[index].second);
+    }
+    EXPECT_EQ(expected, rowsOf(query.topK(25)));
+}
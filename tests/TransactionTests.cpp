@@ -2,59 +2,61 @@
 #include <gmock/gmock.h>
 #include <iostream>
 #include <sstream>
+#include <memory>
 #include "../include/services/TransactionManager.h"
 #include "../include/models/Transaction.h"
-#include "../include/ui/TransactionInput.h"
-
-// Mock class for testing TransactionInput
-class MockTransactionManager : public TransactionManager {
-public:
-    MOCK_CONST_METHOD0(getMonthlyTransactionSummaries, const std::map<std::string, MonthlySummary>& ());
-};
-
-class MockCategoryManager : public CategoryManager {
-    // Empty mock implementation for testing
-};
+#include "../include/ui/TransactionUI.h"
+#include "../include/utils/DateUtils.h"
+#include "TestSupport.h"
 
 // Test fixture for TransactionManager tests
 class TransactionManagerTest : public ::testing::Test {
 protected:
-    TransactionManager manager;
-    time_t baseTime;
+    // Each test gets its own data/ directory, created before the manager loads
+    ScopedWorkingDirectory workingDirectory;
+    std::unique_ptr<TransactionManager> managerPtr;
+    TransactionManager* manager = nullptr;
 
     void SetUp() override {
-        // Create a base time for consistent test results (2023-01-01)
-        struct tm timeInfo = {};
-        timeInfo.tm_year = 2023 - 1900;  // Years since 1900
-        timeInfo.tm_mon = 0;             // 0-indexed month (January)
-        timeInfo.tm_mday = 1;            // Day of month
-        baseTime = mktime(&timeInfo);
+        managerPtr = std::make_unique<TransactionManager>();
+        manager = managerPtr.get();
+    }
+
+    void TearDown() override {
+        // The manager saves on destruction; do it while the directory exists
+        managerPtr.reset();
+    }
+
+    // Month key relative to January 2023 (0 = January 2023, 1 = February 2023, etc.)
+    static MonthKey monthAt(int monthOffset) {
+        return DateUtils::toMonthKey(2023, 1) + static_cast<MonthKey>(monthOffset);
     }
 
-    // Helper to create transactions with relative months (0 = January 2023, 1 = February 2023, etc.)
+    // Helper to create transactions on the first day of a month relative to January 2023
     std::shared_ptr<Transaction> createTransaction(double amount, int monthOffset,
         TransactionType type, const std::string& category) {
-        struct tm timeInfo = *localtime(&baseTime);
-        timeInfo.tm_mon += monthOffset;
-        mktime(&timeInfo);  // Normalize the time (handling year changes if month > 11)
+        MonthKey month = monthAt(monthOffset);
+        DayKey day = DateUtils::daysFromCivil(DateUtils::monthKeyYear(month), DateUtils::monthKeyMonth(month), 1);
 
-        return std::make_shared<Transaction>(amount, mktime(&timeInfo), category, type);
+        Money money;
+        EXPECT_TRUE(Money::tryFromDouble(amount, money));
+        return std::make_shared<Transaction>(money, DateUtils::timeFromDayKey(day), category, type);
     }
 };
 
-// Test fixture for TransactionInput tests
-class TransactionInputTest : public ::testing::Test {
+// Test fixture for TransactionUI tests
+class TransactionUITest : public TransactionManagerTest {
 protected:
-    ::testing::NiceMock<MockTransactionManager> mockManager;
-    MockCategoryManager mockCategoryManager;
-    TransactionInput transactionInput;
+    std::shared_ptr<TransactionManager> sharedManager;
+    std::unique_ptr<TransactionUI> transactionUI;
     std::stringstream testOutput;
-    std::streambuf* originalCoutBuffer;
-
-    // Constructor to initialize TransactionInput with mock managers
-    TransactionInputTest() : transactionInput(mockManager, mockCategoryManager) {}
+    std::streambuf* originalCoutBuffer = nullptr;
 
     void SetUp() override {
+        sharedManager = std::make_shared<TransactionManager>();
+        manager = sharedManager.get();
+        transactionUI = std::make_unique<TransactionUI>(sharedManager, nullptr);
+
         // Redirect cout to our stringstream for testing output
         originalCoutBuffer = std::cout.rdbuf();
         std::cout.rdbuf(testOutput.rdbuf());
@@ -63,268 +65,267 @@ protected:
     void TearDown() override {
         // Restore the original cout buffer
         std::cout.rdbuf(originalCoutBuffer);
-    }
-
-    // Helper function to create a MonthlySummary for testing
-    MonthlySummary createMonthlySummary(double income, double expenses) {
-        MonthlySummary summary = { income, expenses, 0.0 };
-        summary.updateNetAmount();
-        return summary;
+        transactionUI.reset();
+        sharedManager.reset();
     }
 };
 
-// Test case: getMonthlyTransactionSummaries with no transactions
-TEST_F(TransactionManagerTest, GetMonthlyTransactionSummaries_NoTransactions) {
-    // Act: Get monthly summaries when there are no transactions
-    const auto& summaries = manager.getMonthlyTransactionSummaries();
+// Test case: getMonthlyTotals with no transactions
+TEST_F(TransactionManagerTest, GetMonthlyTotals_NoTransactions) {
+    // Act: Get monthly totals when there are no transactions
+    const auto& totals = manager->getMonthlyTotals();
 
     // Assert: The result should be an empty map
-    EXPECT_TRUE(summaries.empty());
+    EXPECT_TRUE(totals.empty());
+}
+
+// Test case: getFinancialSummary rounds a negative mean away from zero
+TEST_F(TransactionManagerTest, GetFinancialSummary_NegativeMean) {
+    // Loaded files may hold negative amounts (refunds, reversals)
+    manager->addTransaction(createTransaction(-0.02, 0, TransactionType::INCOME, "Refund"));
+    manager->addTransaction(createTransaction(-0.01, 0, TransactionType::EXPENSE, "Refund"));
+
+    // -3 cents over 2 rows is -1.5, which rounds to -2
+    EXPECT_EQ(Money::fromCents(-2), manager->getFinancialSummary().meanAmount);
 }
 
-// Test case: getMonthlyTransactionSummaries with single month of data
-TEST_F(TransactionManagerTest, GetMonthlyTransactionSummaries_SingleMonth) {
+// Test case: getMonthlyTotals with single month of data
+TEST_F(TransactionManagerTest, GetMonthlyTotals_SingleMonth) {
     // Arrange: Add a few transactions for the same month
-    manager.addTransaction(createTransaction(100.0, 0, TransactionType::INCOME, "Salary"));
-    manager.addTransaction(createTransaction(50.0, 0, TransactionType::EXPENSE, "Groceries"));
-    manager.addTransaction(createTransaction(25.0, 0, TransactionType::EXPENSE, "Utilities"));
+    manager->addTransaction(createTransaction(100.0, 0, TransactionType::INCOME, "Salary"));
+    manager->addTransaction(createTransaction(50.0, 0, TransactionType::EXPENSE, "Groceries"));
+    manager->addTransaction(createTransaction(25.0, 0, TransactionType::EXPENSE, "Utilities"));
 
-    // Act: Get monthly summaries
-    const auto& summaries = manager.getMonthlyTransactionSummaries();
+    // Act: Get monthly totals
+    const auto& totals = manager->getMonthlyTotals();
 
     // Assert: Should have exactly one month with correct totals
-    ASSERT_EQ(1, summaries.size());
+    ASSERT_EQ(1u, totals.size());
 
-    auto it = summaries.begin();
-    EXPECT_EQ("2023-01", it->first);
-    EXPECT_DOUBLE_EQ(100.0, it->second.totalIncome);
-    EXPECT_DOUBLE_EQ(75.0, it->second.totalExpenses);
-    EXPECT_DOUBLE_EQ(25.0, it->second.netAmount);
+    auto it = totals.begin();
+    EXPECT_EQ("2023-01", DateUtils::formatMonthKey(it->first));
+    EXPECT_EQ(Money::fromCents(10000), it->second.income);
+    EXPECT_EQ(Money::fromCents(7500), it->second.expenses);
+    EXPECT_EQ(Money::fromCents(2500), it->second.getNetAmount());
 }
 
-// Test case: getMonthlyTransactionSummaries with multiple months
-TEST_F(TransactionManagerTest, GetMonthlyTransactionSummaries_MultipleMonths) {
+// Test case: getMonthlyTotals with multiple months
+TEST_F(TransactionManagerTest, GetMonthlyTotals_MultipleMonths) {
     // Arrange: Add transactions for different months
-    manager.addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary January"));   // Jan
-    manager.addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent January"));     // Jan
+    manager->addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary January"));   // Jan
+    manager->addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent January"));     // Jan
 
-    manager.addTransaction(createTransaction(1000.0, 1, TransactionType::INCOME, "Salary February"));  // Feb
-    manager.addTransaction(createTransaction(600.0, 1, TransactionType::EXPENSE, "Rent February"));     // Feb
+    manager->addTransaction(createTransaction(1000.0, 1, TransactionType::INCOME, "Salary February"));  // Feb
+    manager->addTransaction(createTransaction(600.0, 1, TransactionType::EXPENSE, "Rent February"));    // Feb
 
-    manager.addTransaction(createTransaction(1200.0, 2, TransactionType::INCOME, "Salary March"));     // Mar
-    manager.addTransaction(createTransaction(600.0, 2, TransactionType::EXPENSE, "Rent March"));       // Mar
+    manager->addTransaction(createTransaction(1200.0, 2, TransactionType::INCOME, "Salary March"));     // Mar
+    manager->addTransaction(createTransaction(600.0, 2, TransactionType::EXPENSE, "Rent March"));       // Mar
 
-    // Act: Get monthly summaries
-    const auto& summaries = manager.getMonthlyTransactionSummaries();
+    // Act: Get monthly totals
+    const auto& totals = manager->getMonthlyTotals();
 
     // Assert: Should have three months with correct totals
-    ASSERT_EQ(3, summaries.size());
-
-    // Check January summary
-    auto janIt = summaries.find("2023-01");
-    ASSERT_NE(summaries.end(), janIt);
-    EXPECT_DOUBLE_EQ(1000.0, janIt->second.totalIncome);
-    EXPECT_DOUBLE_EQ(500.0, janIt->second.totalExpenses);
-    EXPECT_DOUBLE_EQ(500.0, janIt->second.netAmount);
-
-    // Check February summary
-    auto febIt = summaries.find("2023-02");
-    ASSERT_NE(summaries.end(), febIt);
-    EXPECT_DOUBLE_EQ(1000.0, febIt->second.totalIncome);
-    EXPECT_DOUBLE_EQ(600.0, febIt->second.totalExpenses);
-    EXPECT_DOUBLE_EQ(400.0, febIt->second.netAmount);
-
-    // Check March summary
-    auto marIt = summaries.find("2023-03");
-    ASSERT_NE(summaries.end(), marIt);
-    EXPECT_DOUBLE_EQ(1200.0, marIt->second.totalIncome);
-    EXPECT_DOUBLE_EQ(600.0, marIt->second.totalExpenses);
-    EXPECT_DOUBLE_EQ(600.0, marIt->second.netAmount);
+    ASSERT_EQ(3u, totals.size());
+
+    // Check January totals
+    auto janIt = totals.find(monthAt(0));
+    ASSERT_NE(totals.end(), janIt);
+    EXPECT_EQ(Money::fromCents(100000), janIt->second.income);
+    EXPECT_EQ(Money::fromCents(50000), janIt->second.expenses);
+    EXPECT_EQ(Money::fromCents(50000), janIt->second.getNetAmount());
+
+    // Check February totals
+    auto febIt = totals.find(monthAt(1));
+    ASSERT_NE(totals.end(), febIt);
+    EXPECT_EQ(Money::fromCents(100000), febIt->second.income);
+    EXPECT_EQ(Money::fromCents(60000), febIt->second.expenses);
+    EXPECT_EQ(Money::fromCents(40000), febIt->second.getNetAmount());
+
+    // Check March totals
+    auto marIt = totals.find(monthAt(2));
+    ASSERT_NE(totals.end(), marIt);
+    EXPECT_EQ(Money::fromCents(120000), marIt->second.income);
+    EXPECT_EQ(Money::fromCents(60000), marIt->second.expenses);
+    EXPECT_EQ(Money::fromCents(60000), marIt->second.getNetAmount());
 }
 
-// Test case: getMonthlyTransactionSummaries with cache invalidation
-TEST_F(TransactionManagerTest, GetMonthlyTransactionSummaries_CacheInvalidation) {
-    // Arrange: Add transactions and get summaries to populate cache
-    manager.addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary"));
-    manager.addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent"));
+// Test case: getMonthlyTotals stays current as transactions are added
+TEST_F(TransactionManagerTest, GetMonthlyTotals_UpdatedOnAdd) {
+    // Arrange: Add transactions and read the totals once
+    manager->addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary"));
+    manager->addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent"));
 
-    // First call to populate cache
-    const auto& summaries1 = manager.getMonthlyTransactionSummaries();
-    ASSERT_EQ(1, summaries1.size());
+    ASSERT_EQ(1u, manager->getMonthlyTotals().size());
 
     // Act: Add a new transaction that affects the same month
-    manager.addTransaction(createTransaction(200.0, 0, TransactionType::EXPENSE, "Groceries"));
-
-    // Get summaries again - should reflect the new transaction
-    const auto& summaries2 = manager.getMonthlyTransactionSummaries();
+    manager->addTransaction(createTransaction(200.0, 0, TransactionType::EXPENSE, "Groceries"));
 
     // Assert: Should have updated totals
-    ASSERT_EQ(1, summaries2.size());
-    auto it = summaries2.begin();
-    EXPECT_EQ("2023-01", it->first);
-    EXPECT_DOUBLE_EQ(1000.0, it->second.totalIncome);
-    EXPECT_DOUBLE_EQ(700.0, it->second.totalExpenses);  // 500 + 200
-    EXPECT_DOUBLE_EQ(300.0, it->second.netAmount);      // 1000 - 700
+    const auto& totals = manager->getMonthlyTotals();
+    ASSERT_EQ(1u, totals.size());
+    auto it = totals.begin();
+    EXPECT_EQ("2023-01", DateUtils::formatMonthKey(it->first));
+    EXPECT_EQ(Money::fromCents(100000), it->second.income);
+    EXPECT_EQ(Money::fromCents(70000), it->second.expenses);       // 500 + 200
+    EXPECT_EQ(Money::fromCents(30000), it->second.getNetAmount());  // 1000 - 700
 }
 
-// Test case: getMonthlyTransactionSummaries with new month added
-TEST_F(TransactionManagerTest, GetMonthlyTransactionSummaries_NewMonthAdded) {
-    // Arrange: Add transactions for January and get summaries
-    manager.addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary January"));
-    manager.addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent January"));
+// Test case: getMonthlyTotals with new month added
+TEST_F(TransactionManagerTest, GetMonthlyTotals_NewMonthAdded) {
+    // Arrange: Add transactions for January and read the totals
+    manager->addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary January"));
+    manager->addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent January"));
 
-    // First call to populate cache with January data
-    const auto& summaries1 = manager.getMonthlyTransactionSummaries();
-    ASSERT_EQ(1, summaries1.size());
+    ASSERT_EQ(1u, manager->getMonthlyTotals().size());
 
     // Act: Add transactions for a different month
-    manager.addTransaction(createTransaction(1100.0, 1, TransactionType::INCOME, "Salary February"));
-    manager.addTransaction(createTransaction(550.0, 1, TransactionType::EXPENSE, "Rent February"));
-
-    // Get summaries again - should include the new month
-    const auto& summaries2 = manager.getMonthlyTransactionSummaries();
+    manager->addTransaction(createTransaction(1100.0, 1, TransactionType::INCOME, "Salary February"));
+    manager->addTransaction(createTransaction(550.0, 1, TransactionType::EXPENSE, "Rent February"));
 
     // Assert: Should now have two months
-    ASSERT_EQ(2, summaries2.size());
-
-    // Check January summary (should be unchanged)
-    auto janIt = summaries2.find("2023-01");
-    ASSERT_NE(summaries2.end(), janIt);
-    EXPECT_DOUBLE_EQ(1000.0, janIt->second.totalIncome);
-    EXPECT_DOUBLE_EQ(500.0, janIt->second.totalExpenses);
-    EXPECT_DOUBLE_EQ(500.0, janIt->second.netAmount);
-
-    // Check February summary (should be newly added)
-    auto febIt = summaries2.find("2023-02");
-    ASSERT_NE(summaries2.end(), febIt);
-    EXPECT_DOUBLE_EQ(1100.0, febIt->second.totalIncome);
-    EXPECT_DOUBLE_EQ(550.0, febIt->second.totalExpenses);
-    EXPECT_DOUBLE_EQ(550.0, febIt->second.netAmount);
+    const auto& totals = manager->getMonthlyTotals();
+    ASSERT_EQ(2u, totals.size());
+
+    // Check January totals (should be unchanged)
+    auto janIt = totals.find(monthAt(0));
+    ASSERT_NE(totals.end(), janIt);
+    EXPECT_EQ(Money::fromCents(100000), janIt->second.income);
+    EXPECT_EQ(Money::fromCents(50000), janIt->second.expenses);
+    EXPECT_EQ(Money::fromCents(50000), janIt->second.getNetAmount());
+
+    // Check February totals (should be newly added)
+    auto febIt = totals.find(monthAt(1));
+    ASSERT_NE(totals.end(), febIt);
+    EXPECT_EQ(Money::fromCents(110000), febIt->second.income);
+    EXPECT_EQ(Money::fromCents(55000), febIt->second.expenses);
+    EXPECT_EQ(Money::fromCents(55000), febIt->second.getNetAmount());
 }
 
-// Test case: displayAllMonthlySummaries with no transaction data
-TEST_F(TransactionInputTest, DisplayAllMonthlySummaries_NoTransactions) {
-    // Arrange: Set up mock to return empty map
-    std::map<std::string, MonthlySummary> emptyMap;
-    EXPECT_CALL(mockManager, getMonthlyTransactionSummaries())
-        .WillOnce(::testing::ReturnRef(emptyMap));
+// Test case: Adding a transaction only changes its own month
+TEST_F(TransactionManagerTest, MonthlyTotals_SpecificMonthUpdated) {
+    // Arrange: Add transactions for January and February
+    manager->addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary January"));   // Jan
+    manager->addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent January"));     // Jan
+    manager->addTransaction(createTransaction(1200.0, 1, TransactionType::INCOME, "Salary February"));  // Feb
+    manager->addTransaction(createTransaction(600.0, 1, TransactionType::EXPENSE, "Rent February"));    // Feb
 
-    // Act: Call displayAllMonthlySummaries
-    transactionInput.displayAllMonthlySummaries();
+    const auto& initialTotals = manager->getMonthlyTotals();
+    ASSERT_EQ(2u, initialTotals.size());
 
-    // Assert: Output should indicate no data
-    EXPECT_TRUE(testOutput.str().find("No transaction data available") != std::string::npos);
-}
+    // Verify initial data
+    auto janIt = initialTotals.find(monthAt(0));
+    ASSERT_NE(initialTotals.end(), janIt);
+    EXPECT_EQ(Money::fromCents(100000), janIt->second.income);
+    EXPECT_EQ(Money::fromCents(50000), janIt->second.expenses);
 
-// Test case: displayAllMonthlySummaries with single month of data
-TEST_F(TransactionInputTest, DisplayAllMonthlySummaries_SingleMonth) {
-    // Arrange: Set up mock to return a map with one month
-    std::map<std::string, MonthlySummary> monthlyData;
-    monthlyData["2023-01"] = createMonthlySummary(1000.0, 500.0);
+    // Act: Add a new transaction for January only
+    manager->addTransaction(createTransaction(200.0, 0, TransactionType::INCOME, "Bonus January"));
 
-    EXPECT_CALL(mockManager, getMonthlyTransactionSummaries())
-        .WillOnce(::testing::ReturnRef(monthlyData));
+    const auto& updatedTotals = manager->getMonthlyTotals();
 
-    // Act: Call displayAllMonthlySummaries
-    transactionInput.displayAllMonthlySummaries();
+    // Assert:
+    // 1. January should be updated
+    auto updatedJanIt = updatedTotals.find(monthAt(0));
+    ASSERT_NE(updatedTotals.end(), updatedJanIt);
+    EXPECT_EQ(Money::fromCents(120000), updatedJanIt->second.income);   // 1000 + 200
+    EXPECT_EQ(Money::fromCents(50000), updatedJanIt->second.expenses);  // Unchanged
 
-    // Assert: Output should contain the month and correct values
-    std::string output = testOutput.str();
-    EXPECT_TRUE(output.find("2023-01") != std::string::npos);
-    EXPECT_TRUE(output.find("1000.00") != std::string::npos);  // Income
-    EXPECT_TRUE(output.find("500.00") != std::string::npos);   // Expenses
-    EXPECT_TRUE(output.find("Surplus") != std::string::npos);  // Status
+    // 2. February should remain the same
+    auto febIt = updatedTotals.find(monthAt(1));
+    ASSERT_NE(updatedTotals.end(), febIt);
+    EXPECT_EQ(Money::fromCents(120000), febIt->second.income);   // Unchanged
+    EXPECT_EQ(Money::fromCents(60000), febIt->second.expenses);  // Unchanged
 }
 
-// Test case: displayAllMonthlySummaries with multiple months including deficit
-TEST_F(TransactionInputTest, DisplayAllMonthlySummaries_MultipleMonthsMixedStatus) {
-    // Arrange: Set up mock to return a map with multiple months
-    std::map<std::string, MonthlySummary> monthlyData;
-    monthlyData["2023-01"] = createMonthlySummary(1000.0, 500.0);    // Surplus
-    monthlyData["2023-02"] = createMonthlySummary(500.0, 800.0);     // Deficit
-    monthlyData["2023-03"] = createMonthlySummary(700.0, 700.0);     // Balanced
+// Test case: Edge case with empty totals and immediate transaction addition
+TEST_F(TransactionManagerTest, Edge_EmptyTotalsWithImmediateAddition) {
+    // Initially verify there are no totals
+    EXPECT_TRUE(manager->getMonthlyTotals().empty());
 
-    EXPECT_CALL(mockManager, getMonthlyTransactionSummaries())
-        .WillOnce(::testing::ReturnRef(monthlyData));
+    // Add a transaction
+    manager->addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary"));
 
-    // Act: Call displayAllMonthlySummaries
-    transactionInput.displayAllMonthlySummaries();
+    // Get totals - should contain the new transaction
+    const auto& totals = manager->getMonthlyTotals();
 
-    // Assert: Output should contain all months and correct statuses
-    std::string output = testOutput.str();
-
-    // Check January (surplus)
-    EXPECT_TRUE(output.find("2023-01") != std::string::npos);
-    EXPECT_TRUE(output.find("Surplus") != std::string::npos);
+    // Verify results
+    ASSERT_EQ(1u, totals.size());
+    auto it = totals.begin();
+    EXPECT_EQ("2023-01", DateUtils::formatMonthKey(it->first));
+    EXPECT_EQ(Money::fromCents(100000), it->second.income);
+    EXPECT_EQ(Money(), it->second.expenses);
+    EXPECT_EQ(Money::fromCents(100000), it->second.getNetAmount());
+}
 
-    // Check February (deficit)
-    EXPECT_TRUE(output.find("2023-02") != std::string::npos);
-    EXPECT_TRUE(output.find("Deficit") != std::string::npos);
+// Test case: Transactions carry interned categories and exact amounts
+TEST_F(TransactionManagerTest, Transaction_CategoryAndAmount) {
+    auto first = createTransaction(12.34, 0, TransactionType::EXPENSE, "Groceries");
+    auto second = createTransaction(0.1, 1, TransactionType::EXPENSE, "Groceries");
 
-    // Check March (balanced)
-    EXPECT_TRUE(output.find("2023-03") != std::string::npos);
-    EXPECT_TRUE(output.find("Balanced") != std::string::npos);
+    // The same name interns to the same id
+    EXPECT_EQ(first->getCategoryId(), second->getCategoryId());
+    EXPECT_EQ("Groceries", first->getCategory());
 
-    // Check totals (should sum all months)
-    EXPECT_TRUE(output.find("TOTAL") != std::string::npos);
-    EXPECT_TRUE(output.find("2200.00") != std::string::npos);  // Total income
-    EXPECT_TRUE(output.find("2000.00") != std::string::npos);  // Total expenses
+    // Amounts are whole cents
+    EXPECT_EQ(1234, first->getAmount().getCents());
+    EXPECT_EQ(10, second->getAmount().getCents());
+    EXPECT_EQ(monthAt(1), second->getMonthKey());
 }
 
-// Test case: Specific month cache invalidation when adding a transaction
-TEST_F(TransactionManagerTest, CacheInvalidation_SpecificMonth) {
-    // Arrange: Add transactions for January and February
-    manager.addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary January"));   // Jan
-    manager.addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent January"));     // Jan
-    manager.addTransaction(createTransaction(1200.0, 1, TransactionType::INCOME, "Salary February"));  // Feb
-    manager.addTransaction(createTransaction(600.0, 1, TransactionType::EXPENSE, "Rent February"));    // Feb
-
-    // Populate the cache with initial data
-    const auto& initialSummaries = manager.getMonthlyTransactionSummaries();
-    ASSERT_EQ(2, initialSummaries.size());
-
-    // Verify initial data
-    auto janIt = initialSummaries.find("2023-01");
-    EXPECT_DOUBLE_EQ(1000.0, janIt->second.totalIncome);
-    EXPECT_DOUBLE_EQ(500.0, janIt->second.totalExpenses);
+// Test case: showMonthlySummary with no transaction data
+TEST_F(TransactionUITest, ShowMonthlySummary_NoTransactions) {
+    // Act: Display the summary for an empty ledger
+    transactionUI->showMonthlySummary();
 
-    // Act: Add a new transaction for January only
-    manager.addTransaction(createTransaction(200.0, 0, TransactionType::INCOME, "Bonus January"));
+    // Assert: Output should indicate no data
+    EXPECT_TRUE(testOutput.str().find("No transaction data available") != std::string::npos);
+}
 
-    // Fetch updated summaries
-    const auto& updatedSummaries = manager.getMonthlyTransactionSummaries();
+// Test case: showMonthlySummary with single month of data
+TEST_F(TransactionUITest, ShowMonthlySummary_SingleMonth) {
+    // Arrange: One month with income and expenses
+    manager->addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary"));
+    manager->addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent"));
 
-    // Assert: 
-    // 1. January should be updated
-    auto updatedJanIt = updatedSummaries.find("2023-01");
-    EXPECT_DOUBLE_EQ(1200.0, updatedJanIt->second.totalIncome);  // 1000 + 200
-    EXPECT_DOUBLE_EQ(500.0, updatedJanIt->second.totalExpenses);  // Unchanged
+    // Act: Display the summary
+    transactionUI->showMonthlySummary();
 
-    // 2. February should remain the same
-    auto febIt = updatedSummaries.find("2023-02");
-    EXPECT_DOUBLE_EQ(1200.0, febIt->second.totalIncome);  // Unchanged
-    EXPECT_DOUBLE_EQ(600.0, febIt->second.totalExpenses);  // Unchanged
+    // Assert: Output should contain the month and correct values
+    std::string output = testOutput.str();
+    EXPECT_TRUE(output.find("2023-01") != std::string::npos);
+    EXPECT_TRUE(output.find("1000.00") != std::string::npos);  // Income
+    EXPECT_TRUE(output.find("500.00") != std::string::npos);   // Expenses and net
 }
 
-// Test case: Edge case with empty cache and immediate transaction addition
-TEST_F(TransactionManagerTest, Edge_EmptyCacheWithImmediateAddition) {
-    // Initially verify cache is empty
-    const auto& emptySummaries = manager.getMonthlyTransactionSummaries();
-    EXPECT_TRUE(emptySummaries.empty());
+// Test case: showMonthlySummary with multiple months including a deficit
+TEST_F(TransactionUITest, ShowMonthlySummary_MultipleMonthsMixedStatus) {
+    // Arrange: Surplus, deficit and balanced months
+    manager->addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary"));
+    manager->addTransaction(createTransaction(500.0, 0, TransactionType::EXPENSE, "Rent"));
+    manager->addTransaction(createTransaction(500.0, 1, TransactionType::INCOME, "Salary"));
+    manager->addTransaction(createTransaction(800.0, 1, TransactionType::EXPENSE, "Rent"));
+    manager->addTransaction(createTransaction(700.0, 2, TransactionType::INCOME, "Salary"));
+    manager->addTransaction(createTransaction(700.0, 2, TransactionType::EXPENSE, "Rent"));
 
-    // Add a transaction
-    manager.addTransaction(createTransaction(1000.0, 0, TransactionType::INCOME, "Salary"));
+    // Act: Display the summary
+    transactionUI->showMonthlySummary();
 
-    // Get summaries - should contain the new transaction
-    const auto& summaries = manager.getMonthlyTransactionSummaries();
+    // Assert: Output should contain all months and their net amounts
+    std::string output = testOutput.str();
 
-    // Verify results
-    ASSERT_EQ(1, summaries.size());
-    auto it = summaries.begin();
-    EXPECT_EQ("2023-01", it->first);
-    EXPECT_DOUBLE_EQ(1000.0, it->second.totalIncome);
-    EXPECT_DOUBLE_EQ(0.0, it->second.totalExpenses);
-    EXPECT_DOUBLE_EQ(1000.0, it->second.netAmount);
+    // Months are listed in order
+    size_t janPos = output.find("2023-01");
+    size_t febPos = output.find("2023-02");
+    size_t marPos = output.find("2023-03");
+    ASSERT_NE(std::string::npos, janPos);
+    ASSERT_NE(std::string::npos, febPos);
+    ASSERT_NE(std::string::npos, marPos);
+    EXPECT_LT(janPos, febPos);
+    EXPECT_LT(febPos, marPos);
+
+    // February is a deficit, March is balanced
+    EXPECT_TRUE(output.find(" -300.00\n") != std::string::npos);
+    EXPECT_TRUE(output.find(" 0.00\n") != std::string::npos);
 }
 
 // Additional mocks for input handling
@@ -332,17 +333,8 @@ class InputTestHelper {
 public:
     // Set up the input for testing with a predefined response
     static void setNextInput(const std::string& input) {
-        // Save original buffer
-        std::cin.rdbuf(originalCinBuffer);
-
-        // Clear any existing content in the input stream
-        std::stringstream* ss = dynamic_cast<std::stringstream*>(&mockCin);
-        if (ss) {
-            ss->str("");
-            ss->clear();
-        }
-
-        // Set the new mock input
+        mockCin.str("");
+        mockCin.clear();
         mockCin << input << std::endl;
 
         // Redirect cin to our mock stream
@@ -375,85 +367,68 @@ private:
 std::stringstream InputTestHelper::mockCin;
 std::streambuf* InputTestHelper::originalCinBuffer = nullptr;
 
-// Test for displayMonthlySummary with valid input
-TEST_F(TransactionInputTest, DisplayMonthlySummary_ValidInput) {
-    // Initialize mock for cin
-    InputTestHelper::initMockInput();
+// Test for showTransactionsByMonth with valid input
+TEST_F(TransactionUITest, ShowTransactionsByMonth_ValidInput) {
+    manager->addTransaction(createTransaction(1500.0, 0, TransactionType::INCOME, "Salary"));
+    manager->addTransaction(createTransaction(800.0, 0, TransactionType::EXPENSE, "Rent"));
+    manager->addTransaction(createTransaction(90.0, 1, TransactionType::EXPENSE, "Rent"));
 
-    // Set up the mock input to provide a valid yearMonth when prompted
+    // Provide the month when prompted
+    InputTestHelper::initMockInput();
     InputTestHelper::setNextInput("2023-01");
 
-    // Mock the TransactionManager's calculateMonthlySummary to return a predefined summary
-    MonthlySummary mockSummary = { 1500.0, 800.0, 700.0 };
-    EXPECT_CALL(mockManager, calculateMonthlySummary(testing::StrEq("2023-01")))
-        .WillOnce(testing::Return(mockSummary));
-
     // Act: Call the method that will prompt for input and display results
-    transactionInput.displayMonthlySummary();
+    transactionUI->showTransactionsByMonth();
 
     // Reset cin to its original state
     InputTestHelper::resetCin();
 
-    // Get the output and check it
+    // Verify the output lists only January's rows
     std::string output = testOutput.str();
+    EXPECT_TRUE(output.find("Found 2 transaction(s) for month 2023-01") != std::string::npos);
+    EXPECT_TRUE(output.find("1500.00") != std::string::npos);
+    EXPECT_TRUE(output.find("800.00") != std::string::npos);
+    EXPECT_TRUE(output.find("90.00") == std::string::npos);
+}
 
-    // Verify the output contains expected values
-    EXPECT_TRUE(output.find("Monthly Summary for 2023-01") != std::string::npos);
-    EXPECT_TRUE(output.find("1500.00") != std::string::npos);  // Income
-    EXPECT_TRUE(output.find("800.00") != std::string::npos);   // Expenses
-    EXPECT_TRUE(output.find("700.00") != std::string::npos);   // Net amount
-    EXPECT_TRUE(output.find("Surplus") != std::string::npos);  // Status
+// Test for showTransactionsByAmountRange re-prompting when the maximum overflows
+TEST_F(TransactionUITest, ShowTransactionsByAmountRange_TooLargeMaximum) {
+    manager->addTransaction(createTransaction(250.0, 0, TransactionType::EXPENSE, "Rent"));
+
+    // 1e20 dollars does not fit in 64-bit cents; the second maximum does
+    InputTestHelper::initMockInput();
+    InputTestHelper::setNextInput("0\n1e20\n1000");
+
+    transactionUI->showTransactionsByAmountRange();
+
+    InputTestHelper::resetCin();
+
+    std::string output = testOutput.str();
+    EXPECT_TRUE(output.find("Maximum amount is too large") != std::string::npos);
+    EXPECT_TRUE(output.find("250.00") != std::string::npos);
 }
 
-// Test for YYYY-MM format validation in getMonthlyTransactionSummaries
-TEST_F(TransactionManagerTest, FormatValidation_YearMonth) {
-    // Non-integer Month - Should Throw
-    try {
-        manager.getTransactionsByMonth("2023-AB");
-        FAIL() << "Expected std::invalid_argument for non-integer month";
-    }
-    catch (const std::invalid_argument& e) {
-        EXPECT_TRUE(std::string(e.what()).find("Invalid year or month format") != std::string::npos);
-    }
-    catch (...) {
-        FAIL() << "Expected std::invalid_argument, got different exception";
-    }
+// Test for YYYY-MM format validation
+TEST(DateUtilsTest, FormatValidation_YearMonth) {
+    MonthKey key = 0;
 
-    // Month out of range - Should Throw
-    try {
-        manager.getTransactionsByMonth("2023-13");
-        FAIL() << "Expected std::invalid_argument for month > 12";
-    }
-    catch (const std::invalid_argument& e) {
-        EXPECT_TRUE(std::string(e.what()).find("Month must be between") != std::string::npos);
-    }
-    catch (...) {
-        FAIL() << "Expected std::invalid_argument, got different exception";
-    }
+    // Non-integer month
+    EXPECT_FALSE(DateUtils::parseYearMonth("2023-AB", key));
 
-    // Wrong format (missing hyphen) - Should Throw
-    try {
-        manager.getTransactionsByMonth("202301");
-        FAIL() << "Expected std::invalid_argument for missing hyphen";
-    }
-    catch (const std::invalid_argument& e) {
-        EXPECT_TRUE(std::string(e.what()).find("YYYY-MM") != std::string::npos);
-    }
-    catch (...) {
-        FAIL() << "Expected std::invalid_argument, got different exception";
-    }
+    // Month out of range
+    EXPECT_FALSE(DateUtils::parseYearMonth("2023-13", key));
+    EXPECT_FALSE(DateUtils::parseYearMonth("2023-00", key));
 
-    // Correct format - Should Not Throw
-    try {
-        manager.getTransactionsByMonth("2023-01");
-        // Test passes if no exception is thrown
-    }
-    catch (...) {
-        FAIL() << "No exception expected for valid format";
-    }
+    // Wrong format (missing hyphen)
+    EXPECT_FALSE(DateUtils::parseYearMonth("202301", key));
+
+    // Correct format
+    ASSERT_TRUE(DateUtils::parseYearMonth("2023-01", key));
+    EXPECT_EQ(DateUtils::toMonthKey(2023, 1), key);
+    EXPECT_EQ("2023-01", DateUtils::formatMonthKey(key));
 }
 
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}